@@ -13,6 +13,7 @@
 #include "fem/fespace.hpp"
 #include "fem/mesh.hpp"
 #include "linalg/ksp.hpp"
+#include "linalg/telemetry.hpp"
 #include "models/domainpostoperator.hpp"
 #include "models/postoperator.hpp"
 #include "models/surfacepostoperator.hpp"
@@ -160,6 +161,7 @@ void BaseSolver::SolveEstimateMarkRefine(std::vector<std::unique_ptr<Mesh>> &mes
   MPI_Comm comm = mesh.back()->GetComm();
 
   // Perform initial solve and estimation.
+  SolverTelemetry::SetAdaptIteration(0);
   auto [indicators, ntdof] = Solve(mesh);
   double err = indicators.Norml2(comm);
 
@@ -233,8 +235,7 @@ void BaseSolver::SolveEstimateMarkRefine(std::vector<std::unique_ptr<Mesh>> &mes
       {
         int min_elem, max_elem;
         min_elem = max_elem = mesh.back()->GetNE();
-        Mpi::GlobalMin(1, &min_elem, comm);
-        Mpi::GlobalMax(1, &max_elem, comm);
+        Mpi::GlobalMinMax(1, &min_elem, &max_elem, comm);
         const auto ratio_post = double(max_elem) / min_elem;
         Mpi::Print(" Rebalanced mesh: Ratio {:.3f} exceeded max. allowed value {:.3f} "
                    "(new ratio = {:.3f})\n",
@@ -245,6 +246,7 @@ void BaseSolver::SolveEstimateMarkRefine(std::vector<std::unique_ptr<Mesh>> &mes
 
     // Solve + estimate.
     Mpi::Print("\nProceeding with solve/estimate iteration {}...\n", it + 1);
+    SolverTelemetry::SetAdaptIteration(it);
     std::tie(indicators, ntdof) = Solve(mesh);
     err = indicators.Norml2(comm);
   }
@@ -295,6 +297,10 @@ void BaseSolver::SaveMetadata(const SolverType &ksp) const
     meta["LinearSolver"]["TotalIts"] = ksp.NumTotalMultIterations();
     WriteMetadata(post_dir, meta);
   }
+  if (const auto *telemetry = ksp.GetTelemetry())
+  {
+    PostprocessTelemetry(*telemetry);
+  }
 }
 
 void BaseSolver::SaveMetadata(const Timer &timer) const
@@ -763,13 +769,28 @@ void BaseSolver::PostprocessFields(const PostOperator &post_op, int step, double
 void BaseSolver::PostprocessErrorIndicator(const PostOperator &post_op,
                                            const ErrorIndicator &indicator,
                                            bool fields) const
+{
+  if (post_dir.length() == 0)
+  {
+    return;
+  }
+  PostprocessErrorIndicator(post_op.GetComm(), indicator);
+  if (fields)
+  {
+    BlockTimer bt(Timer::IO);
+    post_op.WriteFieldsFinal(&indicator);
+    Mpi::Barrier(post_op.GetComm());
+  }
+}
+
+void BaseSolver::PostprocessErrorIndicator(MPI_Comm comm,
+                                           const ErrorIndicator &indicator) const
 {
   // Write the indicator statistics.
   if (post_dir.length() == 0)
   {
     return;
   }
-  MPI_Comm comm = post_op.GetComm();
   std::array<double, 4> data = {indicator.Norml2(comm), indicator.Min(comm),
                                 indicator.Max(comm), indicator.Mean(comm)};
   if (root)
@@ -789,11 +810,99 @@ void BaseSolver::PostprocessErrorIndicator(const PostOperator &post_op,
                  data[3], table.w, table.p);
     // clang-format on
   }
-  if (fields)
+}
+
+void BaseSolver::PostprocessTelemetry(const SolverTelemetry &telemetry) const
+{
+  // Write one row per iteration to the CSV file and one object per solve to the JSON file.
+  // Results from subsequent AMR iterations are appended.
+  if (post_dir.length() == 0 || !root)
   {
-    BlockTimer bt(Timer::IO);
-    post_op.WriteFieldsFinal(&indicator);
-    Mpi::Barrier(post_op.GetComm());
+    return;
+  }
+  const auto &solves = telemetry.GetSolves();
+  const bool append = (SolverTelemetry::GetAdaptIteration() > 0);
+  const std::string tag = solves.empty() ? "" : solves.front().tag;
+  {
+    std::string path = post_dir + "linear-solver-telemetry.csv";
+    auto output = OutputFile(path, append);
+    if (!append)
+    {
+      // clang-format off
+      output.print("{:>{}s},{:>{}s},{}{:>{}s},{:>{}s},{:>{}s},{:>{}s},{:>{}s},{:>{}s}\n",
+                   "AMR It.", table.w1,
+                   "Solve", table.w1,
+                   tag.empty() ? "" : fmt::format("{:>{}s},", tag, table.w),
+                   "Iteration", table.w1,
+                   "Residual", table.w,
+                   "Operator (s)", table.w,
+                   "Precond. (s)", table.w,
+                   "Orthog. (s)", table.w,
+                   "Reductions", table.w1);
+      // clang-format on
+    }
+    for (std::size_t i = 0; i < solves.size(); i++)
+    {
+      const auto &solve = solves[i];
+      for (const auto &data : solve.iterations)
+      {
+        // clang-format off
+        output.print("{:{}d},{:{}d},{}{:{}d},{:+{}.{}e},{:+{}.{}e},{:+{}.{}e},{:+{}.{}e},"
+                     "{:{}d}\n",
+                     solve.adapt_it, table.w1,
+                     i + 1, table.w1,
+                     tag.empty() ? "" : fmt::format("{:+{}.{}e},", solve.tag_value,
+                                                    table.w, table.p),
+                     data.it, table.w1,
+                     data.res, table.w, table.p,
+                     data.t_op, table.w, table.p,
+                     data.t_pc, table.w, table.p,
+                     data.t_orth, table.w, table.p,
+                     data.n_red, table.w1);
+        // clang-format on
+      }
+    }
+  }
+  {
+    std::string path = post_dir + "linear-solver-telemetry.json";
+    json out = json::array();
+    if (append)
+    {
+      std::ifstream fi(path);
+      if (fi.is_open())
+      {
+        out = json::parse(fi);
+      }
+    }
+    for (std::size_t i = 0; i < solves.size(); i++)
+    {
+      const auto &solve = solves[i];
+      json data;
+      data["AMRIteration"] = solve.adapt_it;
+      data["Solve"] = i + 1;
+      if (!solve.tag.empty())
+      {
+        data["Tag"] = solve.tag;
+        data["TagValue"] = solve.tag_value;
+      }
+      data["Converged"] = solve.converged;
+      data["Iterations"] = solve.iterations.empty() ? 0 : solve.iterations.back().it;
+      for (const auto &it_data : solve.iterations)
+      {
+        data["Residual"].push_back(it_data.res);
+        data["TimeOperator"].push_back(it_data.t_op);
+        data["TimePreconditioner"].push_back(it_data.t_pc);
+        data["TimeOrthogonalization"].push_back(it_data.t_orth);
+        data["Reductions"].push_back(it_data.n_red);
+      }
+      out.push_back(std::move(data));
+    }
+    std::ofstream fo(path);
+    if (!fo.is_open())
+    {
+      MFEM_ABORT("Unable to open telemetry file \"" << path << "\"!");
+    }
+    fo << out.dump(2) << '\n';
   }
 }
 
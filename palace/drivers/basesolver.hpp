@@ -7,6 +7,7 @@
 #include <memory>
 #include <string>
 #include <vector>
+#include <mpi.h>
 #include <fmt/os.h>
 
 namespace palace
@@ -17,6 +18,7 @@ class FiniteElementSpaceHierarchy;
 class Mesh;
 class IoData;
 class PostOperator;
+class SolverTelemetry;
 class Timer;
 
 //
@@ -71,6 +73,10 @@ protected:
   // Common error indicator postprocessing for all simulation types.
   void PostprocessErrorIndicator(const PostOperator &post_op,
                                  const ErrorIndicator &indicator, bool fields) const;
+  void PostprocessErrorIndicator(MPI_Comm comm, const ErrorIndicator &indicator) const;
+
+  // Write the recorded per-iteration linear solver telemetry.
+  void PostprocessTelemetry(const SolverTelemetry &telemetry) const;
 
   // Performs a solve using the mesh sequence, then reports error indicators and the number
   // of global true dofs.
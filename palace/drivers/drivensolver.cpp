@@ -4,11 +4,16 @@
 #include "drivensolver.hpp"
 
 #include <complex>
+#include <fstream>
+#include <string>
+#include <vector>
 #include <mfem.hpp>
+#include <nlohmann/json.hpp>
 #include "fem/errorindicator.hpp"
 #include "fem/mesh.hpp"
 #include "linalg/errorestimator.hpp"
 #include "linalg/ksp.hpp"
+#include "linalg/telemetry.hpp"
 #include "linalg/operator.hpp"
 #include "linalg/vector.hpp"
 #include "models/lumpedportoperator.hpp"
@@ -18,6 +23,7 @@
 #include "models/surfacecurrentoperator.hpp"
 #include "models/waveportoperator.hpp"
 #include "utils/communication.hpp"
+#include "utils/filesystem.hpp"
 #include "utils/iodata.hpp"
 #include "utils/prettyprint.hpp"
 #include "utils/timer.hpp"
@@ -25,11 +31,306 @@
 namespace palace
 {
 
+using json = nlohmann::json;
 using namespace std::complex_literals;
 
+namespace
+{
+
+std::string GetGroupPostDir(const std::string &output, int group)
+{
+  return fmt::format("{}group{:d}/", output, group);
+}
+
+std::string GetExcitationPostDir(const std::string &output, int idx)
+{
+  return output.empty() ? output : fmt::format("{}excitation{:d}/", output, idx);
+}
+
+void MergeGroupTelemetry(const std::string &output, int n_group, bool append)
+{
+  // The linear solver telemetry has a variable number of rows per solve, so whole solves
+  // are interleaved across the groups (in order of increasing frequency) and renumbered,
+  // rather than single rows.
+  namespace fs = std::filesystem;
+  const std::string csv = "linear-solver-telemetry.csv";
+  const std::string js = "linear-solver-telemetry.json";
+  if (!fs::exists(GetGroupPostDir(output, 0) + csv))
+  {
+    return;
+  }
+  std::string header;
+  std::vector<std::vector<std::vector<std::string>>> solves(n_group);
+  for (int g = 0; g < n_group; g++)
+  {
+    std::ifstream fi(GetGroupPostDir(output, g) + csv);
+    MFEM_VERIFY(fi.is_open(), "Unable to open postprocessing file \""
+                                  << GetGroupPostDir(output, g) + csv
+                                  << "\" for frequency group merge!");
+    std::string line, key;
+    std::getline(fi, header);
+    while (std::getline(fi, line) && !line.empty())
+    {
+      // The first two columns (AMR iteration and solve index) identify each solve.
+      const auto pos = line.find(',', line.find(',') + 1);
+      if (solves[g].empty() || line.compare(0, pos, key) != 0)
+      {
+        key = line.substr(0, pos);
+        solves[g].emplace_back();
+      }
+      solves[g].back().push_back(line);
+    }
+  }
+  std::ofstream fo(output + csv, append ? std::ios::app : std::ios::trunc);
+  MFEM_VERIFY(fo.is_open(),
+              "Unable to open postprocessing file \"" << output + csv << "\"!");
+  if (!append)
+  {
+    fo << header << '\n';
+  }
+  int solve = 0;
+  for (std::size_t k = 0; true; k++)
+  {
+    bool done = true;
+    for (int g = 0; g < n_group; g++)
+    {
+      if (k >= solves[g].size())
+      {
+        continue;
+      }
+      done = false;
+      solve++;
+      for (auto &line : solves[g][k])
+      {
+        const auto begin = line.find(',') + 1, end = line.find(',', begin);
+        line.replace(begin, end - begin, fmt::format("{:{}d}", solve, end - begin));
+        fo << line << '\n';
+      }
+    }
+    if (done)
+    {
+      break;
+    }
+  }
+
+  std::vector<json> data(n_group);
+  for (int g = 0; g < n_group; g++)
+  {
+    std::ifstream fi(GetGroupPostDir(output, g) + js);
+    MFEM_VERIFY(fi.is_open(), "Unable to open postprocessing file \""
+                                  << GetGroupPostDir(output, g) + js
+                                  << "\" for frequency group merge!");
+    data[g] = json::parse(fi);
+  }
+  json out = json::array();
+  if (append)
+  {
+    std::ifstream fi(output + js);
+    if (fi.is_open())
+    {
+      out = json::parse(fi);
+    }
+  }
+  solve = 0;
+  for (std::size_t k = 0; true; k++)
+  {
+    bool done = true;
+    for (int g = 0; g < n_group; g++)
+    {
+      if (k < data[g].size())
+      {
+        done = false;
+        data[g][k]["Solve"] = ++solve;
+        out.push_back(std::move(data[g][k]));
+      }
+    }
+    if (done)
+    {
+      break;
+    }
+  }
+  std::ofstream fjo(output + js);
+  MFEM_VERIFY(fjo.is_open(),
+              "Unable to open postprocessing file \"" << output + js << "\"!");
+  fjo << out.dump(2) << '\n';
+  for (int g = 0; g < n_group; g++)
+  {
+    fs::remove(GetGroupPostDir(output, g) + csv);
+    fs::remove(GetGroupPostDir(output, g) + js);
+  }
+}
+
+void MergeGroupCSV(const std::string &output, const std::string &dir, int n_group,
+                   bool append)
+{
+  // The frequency samples of the groups are strided by the number of groups, so the rows of
+  // each postprocessed CSV file are merged by interleaving them. Subdirectories, such as
+  // those for separate port excitations, are merged recursively.
+  namespace fs = std::filesystem;
+  std::vector<std::string> files, dirs;
+  for (const auto &f : fs::directory_iterator(GetGroupPostDir(output, 0) + dir))
+  {
+    if (fs::is_directory(f.path()))
+    {
+      dirs.push_back(f.path().filename().string() + "/");
+    }
+    else if (f.path().extension() == ".csv")
+    {
+      files.push_back(f.path().filename().string());
+    }
+  }
+  if (!files.empty())
+  {
+    fs::create_directories(output + dir);
+  }
+  for (const auto &file : files)
+  {
+    if (file != "error-indicators.csv")
+    {
+      std::vector<std::ifstream> fi;
+      fi.reserve(n_group);
+      for (int g = 0; g < n_group; g++)
+      {
+        fi.emplace_back(GetGroupPostDir(output, g) + dir + file);
+        MFEM_VERIFY(fi.back().is_open(), "Unable to open postprocessing file \""
+                                             << GetGroupPostDir(output, g) + dir + file
+                                             << "\" for frequency group merge!");
+      }
+      std::ofstream fo(output + dir + file, append ? std::ios::app : std::ios::trunc);
+      MFEM_VERIFY(fo.is_open(),
+                  "Unable to open postprocessing file \"" << output + dir + file << "\"!");
+      std::string line;
+      for (int g = 0; g < n_group; g++)
+      {
+        std::getline(fi[g], line);  // Header
+        if (g == 0 && !append)
+        {
+          fo << line << '\n';
+        }
+      }
+      for (bool done = false; !done;)
+      {
+        for (int g = 0; g < n_group; g++)
+        {
+          if (!std::getline(fi[g], line) || line.empty())
+          {
+            done = true;
+            break;
+          }
+          fo << line << '\n';
+        }
+      }
+    }
+    for (int g = 0; g < n_group; g++)
+    {
+      fs::remove(GetGroupPostDir(output, g) + dir + file);
+    }
+  }
+  for (const auto &subdir : dirs)
+  {
+    MergeGroupCSV(output, dir + subdir, n_group, append);
+  }
+}
+
+void ExtrapolateSolution(const ComplexVector *E_h, const double *omega_h, int n,
+                         double omega, ComplexVector &E)
+{
+  // Evaluate the Lagrange interpolating polynomial through the n previous solutions at the
+  // new frequency.
+  E = 0.0;
+  for (int j = 0; j < n; j++)
+  {
+    double l = 1.0;
+    for (int m = 0; m < n; m++)
+    {
+      if (m != j)
+      {
+        l *= (omega - omega_h[m]) / (omega_h[j] - omega_h[m]);
+      }
+    }
+    E.Add(l, E_h[j]);
+  }
+}
+
+}  // namespace
+
+void DrivenSolver::MergeGroupPostprocessing(const std::string &output, int n_group,
+                                            bool append)
+{
+  MergeGroupTelemetry(output, n_group, append);
+  MergeGroupCSV(output, "", n_group, append);
+}
+
+std::pair<ErrorIndicator, long long int>
+DrivenSolver::SolveFrequencyGroups(const std::vector<std::unique_ptr<Mesh>> &mesh) const
+{
+  // Each group of processes performs a uniform sweep over a strided subset of the frequency
+  // samples, with its own copy of the mesh on the group communicator. Postprocessing output
+  // is written to a subdirectory for each group and merged once all groups have finished.
+  // The group sweeps use the global frequency step indices for field output, so the fields
+  // are saved at the same frequencies and with the same numbering as for a single group.
+  MPI_Comm comm = mesh.back()->GetComm();
+  const auto &driven = iodata.solver.driven;
+  const int n_group = driven.n_group;
+  const int group = Mpi::Rank(Mpi::World()) / Mpi::Size(comm);
+  const int n_step = GetNumSteps(driven.min_f, driven.max_f, driven.delta_f);
+  const int step0 = (driven.rst > 0) ? driven.rst - 1 : 0;
+  MFEM_VERIFY(n_step - step0 >= n_group,
+              "Frequency-parallel sweep requires at least as many frequency samples ("
+                  << n_step - step0 << ") as frequency groups (" << n_group << ")!");
+  std::pair<ErrorIndicator, long long int> result;
+  {
+    IoData group_iodata(iodata);
+    group_iodata.problem.output =
+        (post_dir.length() > 0) ? GetGroupPostDir(post_dir, group) : post_dir;
+    auto &group_driven = group_iodata.solver.driven;
+    group_driven.min_f = driven.min_f + (step0 + group) * driven.delta_f;
+    group_driven.delta_f = n_group * driven.delta_f;
+    group_driven.rst = 1;
+    group_driven.n_group = 1;
+    DrivenSolver group_solver(group_iodata, Mpi::Root(comm));
+    group_solver.step_offset = step0 + group;
+    group_solver.step_stride = n_group;
+    result = group_solver.Solve(mesh);
+  }
+  auto &indicator = result.first;
+
+  // The meshes for all groups are partitioned identically, so the error indicators can be
+  // combined across the processes with the same rank in each group. Check that the number
+  // of local elements agrees before summing.
+  {
+    MPI_Comm inter_comm;
+    MPI_Comm_split(Mpi::World(), Mpi::Rank(comm), group, &inter_comm);
+    int ne[2] = {indicator.Local().Size(), -indicator.Local().Size()};
+    Mpi::GlobalMax(2, ne, inter_comm);
+    int mismatch = (ne[0] != -ne[1]);
+    Mpi::GlobalMax(1, &mismatch, Mpi::World());
+    MFEM_VERIFY(!mismatch, "Frequency groups have inconsistent mesh partitions, unable to "
+                           "combine error indicators!");
+    indicator.Reduce(inter_comm);
+    MPI_Comm_free(&inter_comm);
+  }
+
+  // Merge the postprocessed results from all groups.
+  BlockTimer bt(Timer::POSTPRO);
+  Mpi::Barrier(Mpi::World());
+  if (root && post_dir.length() > 0)
+  {
+    MergeGroupPostprocessing(post_dir, n_group, step0 > 0);
+  }
+  PostprocessErrorIndicator(comm, indicator);
+  Mpi::Barrier(Mpi::World());
+  return result;
+}
+
 std::pair<ErrorIndicator, long long int>
 DrivenSolver::Solve(const std::vector<std::unique_ptr<Mesh>> &mesh) const
 {
+  if (iodata.solver.driven.n_group > 1)
+  {
+    return SolveFrequencyGroups(mesh);
+  }
+
   // Set up the spatial discretization and frequency sweep.
   BlockTimer bt0(Timer::CONSTRUCT);
   SpaceOperator space_op(iodata, mesh);
@@ -38,8 +339,9 @@ DrivenSolver::Solve(const std::vector<std::unique_ptr<Mesh>> &mesh) const
   int step0 = (iodata.solver.driven.rst > 0) ? iodata.solver.driven.rst - 1 : 0;
   double delta_omega = iodata.solver.driven.delta_f;
   double omega0 = iodata.solver.driven.min_f + step0 * delta_omega;
-  bool adaptive = (iodata.solver.driven.adaptive_tol > 0.0);
-  if (adaptive && n_step <= 2)
+  bool adaptive = (iodata.solver.driven.adaptive_tol > 0.0 ||
+                   !iodata.solver.driven.adaptive_load_rom.empty());
+  if (adaptive && n_step <= 2 && iodata.solver.driven.adaptive_load_rom.empty())
   {
     Mpi::Warning("Adaptive frequency sweep requires > 2 total frequency samples!\n"
                  "Reverting to uniform sweep!\n");
@@ -131,6 +433,141 @@ ErrorIndicator DrivenSolver::SweepUniform(SpaceOperator &space_op, PostOperator
   ComplexKspSolver ksp(iodata, space_op.GetNDSpaces(), &space_op.GetH1Spaces());
   ksp.SetOperators(*A, *P);
 
+  // Optionally stop the linear solves once the lumped port S-parameters and voltages, which
+  // are linear functionals of the solution and the only quantities consumed by the port
+  // postprocessing, have converged. The dimensionless S-parameters (group 0, nominal
+  // magnitude 1) and the voltages (group 1) are normalized separately. The functional for
+  // the S-parameter of an excited port includes the incident part, which is subtracted
+  // before measuring its magnitude, and so must be updated when the excitation changes.
+  std::vector<ComplexVector> qoi;
+  std::vector<int> qoi_groups;
+  auto SetQoIFunctionals = [&]()
+  {
+    if (qoi.empty())
+    {
+      return;
+    }
+    std::vector<double> qoi_offsets;
+    qoi_offsets.reserve(qoi.size());
+    for (const auto &[idx, data] : space_op.GetLumpedPortOp())
+    {
+      qoi_offsets.push_back(data.excitation ? 1.0 : 0.0);
+      qoi_offsets.push_back(0.0);
+    }
+    ksp.SetQoIFunctionals(qoi, qoi_offsets, qoi_groups, {1.0, 0.0},
+                          iodata.solver.driven.port_qoi_tol);
+  };
+  if (iodata.solver.driven.port_qoi_tol > 0.0)
+  {
+    if (iodata.solver.linear.ksp_type != config::LinearSolverData::KspType::GMRES)
+    {
+      Mpi::Warning("Port quantity stopping criterion is only supported for GMRES and will "
+                   "be ignored!\n");
+    }
+    else if (space_op.GetLumpedPortOp().Size() > 0)
+    {
+      auto &nd_fespace = space_op.GetNDSpace().Get();
+      qoi.reserve(2 * space_op.GetLumpedPortOp().Size());
+      for (const auto &[idx, data] : space_op.GetLumpedPortOp())
+      {
+        for (bool voltage : {false, true})
+        {
+          auto &l = qoi.emplace_back(Curl.Width());
+          qoi_groups.push_back(voltage ? 1 : 0);
+          l.UseDevice(true);
+          if (voltage)
+          {
+            data.GetVoltageFunctional(nd_fespace, l.Real());
+          }
+          else
+          {
+            data.GetSParameterFunctional(nd_fespace, l.Real());
+          }
+          l.Imag() = 0.0;
+        }
+      }
+      SetQoIFunctionals();
+    }
+  }
+
+  // Optionally reuse the preconditioner over nearby frequencies, rebuilding it when the
+  // frequency has moved too far or the iteration count has grown too much.
+  const double pc_reuse_tol = iodata.solver.driven.pc_reuse_tol;
+  const double pc_reuse_it_factor = iodata.solver.driven.pc_reuse_it_factor;
+  double omega_pc = omega0;
+  int pc_it = -1;
+  bool pc_update = false;
+
+  // With separate excitations, each lumped or wave port marked for excitation is excited in
+  // turn at every frequency, reusing the system operators and preconditioner. The solution
+  // for each excitation is postprocessed with the same PostOperator by a separate driver
+  // writing to a subdirectory, while the full S-matrix is written here. S-parameters are
+  // only defined between ports of the same type, so each column of the S-matrix only has
+  // entries for the ports of the same type as the excited port.
+  std::vector<std::pair<int, bool>> excitations;  // (Port index, wave port)
+  if (iodata.solver.driven.separate_excitations)
+  {
+    MFEM_VERIFY(space_op.GetSurfaceCurrentOp().Size() == 0,
+                "Separate port excitations are not supported with surface current "
+                "excitations!");
+    for (const auto &[idx, data] : space_op.GetLumpedPortOp())
+    {
+      if (data.excitation)
+      {
+        excitations.emplace_back(idx, false);
+      }
+    }
+    for (const auto &[idx, data] : space_op.GetWavePortOp())
+    {
+      if (data.excitation)
+      {
+        excitations.emplace_back(idx, true);
+      }
+    }
+  }
+  const int n_ex = std::max(static_cast<int>(excitations.size()), 1);
+  std::vector<IoData> ex_iodata;
+  std::vector<std::unique_ptr<DrivenSolver>> ex_solver;
+  std::vector<int> ex_output;
+  if (!excitations.empty())
+  {
+    ex_iodata.reserve(excitations.size());
+    for (const auto &[idx, wave] : excitations)
+    {
+      auto &ex_data = ex_iodata.emplace_back(iodata);
+      ex_data.problem.output = GetExcitationPostDir(post_dir, idx);
+      ex_data.solver.driven.separate_excitations = false;
+    }
+    for (const auto &ex_data : ex_iodata)
+    {
+      ex_solver.push_back(std::make_unique<DrivenSolver>(ex_data, root));
+      ex_solver.back()->step_offset = step_offset;
+      ex_solver.back()->step_stride = step_stride;
+      ex_output.push_back(post_op.AddDataCollection(ex_data, "driven"));
+    }
+    if (space_op.GetLumpedPortOp().Size() > 0 && space_op.GetWavePortOp().Size() > 0)
+    {
+      Mpi::Warning("S-matrix entries between lumped and wave ports are not computed for "
+                   "separate port excitations!\n");
+    }
+  }
+  auto SetExcitation = [&](int ex)
+  {
+    for (int k = 0; k < static_cast<int>(excitations.size()); k++)
+    {
+      const auto &[idx, wave] = excitations[k];
+      if (wave)
+      {
+        space_op.GetWavePortOp().SetExcitation(idx, k == ex);
+      }
+      else
+      {
+        space_op.GetLumpedPortOp().SetExcitation(idx, k == ex);
+      }
+    }
+    SetQoIFunctionals();
+  };
+
   // Set up RHS vector for the incident field at port boundaries, and the vector for the
   // first frequency step.
   ComplexVector RHS(Curl.Width()), E(Curl.Width()), B(Curl.Height());
@@ -140,6 +577,21 @@ ErrorIndicator DrivenSolver::SweepUniform(SpaceOperator &space_op, PostOperator
   E = 0.0;
   B = 0.0;
 
+  // Storage for the solutions at previous frequencies, used to extrapolate the initial
+  // guess for the linear solver. With separate excitations, the previous solution is always
+  // stored for each excitation.
+  const int guess_order =
+      iodata.solver.linear.initial_guess ? iodata.solver.driven.guess_order : 0;
+  const int n_h_max = (guess_order > 0) ? guess_order + 1
+                                        : (iodata.solver.linear.initial_guess && n_ex > 1);
+  std::vector<ComplexVector> E_h(n_ex * n_h_max);
+  std::vector<double> omega_h(n_h_max);
+  for (auto &Eh : E_h)
+  {
+    Eh.SetSize(Curl.Width());
+    Eh.UseDevice(true);
+  }
+
   // Initialize structures for storing and reducing the results of error estimation.
   TimeDependentFluxErrorEstimator<ComplexVector> estimator(
       space_op.GetMaterialOp(), space_op.GetNDSpaces(), space_op.GetRTSpaces(),
@@ -156,6 +608,7 @@ ErrorIndicator DrivenSolver::SweepUniform(SpaceOperator &space_op, PostOperator
     const double freq = iodata.DimensionalizeValue(IoData::ValueType::FREQUENCY, omega);
     Mpi::Print("\nIt {:d}/{:d}: ω/2π = {:.3e} GHz (elapsed time = {:.2e} s)\n", step + 1,
                n_step, freq, Timer::Duration(Timer::Now() - t0).count());
+    SolverTelemetry::SetTag("f (GHz)", freq);
 
     // Assemble and solve the linear system.
     if (step > step0)
@@ -165,47 +618,143 @@ ErrorIndicator DrivenSolver::SweepUniform(SpaceOperator &space_op, PostOperator
       A = space_op.GetSystemMatrix(std::complex<double>(1.0, 0.0), 1i * omega,
                                    std::complex<double>(-omega * omega, 0.0), K.get(),
                                    C.get(), M.get(), A2.get());
-      P = space_op.GetPreconditionerMatrix<ComplexOperator>(1.0, omega, -omega * omega,
-                                                            omega);
-      ksp.SetOperators(*A, *P);
+      if (pc_update || std::abs(omega - omega_pc) > pc_reuse_tol * std::abs(omega_pc))
+      {
+        P = space_op.GetPreconditionerMatrix<ComplexOperator>(1.0, omega, -omega * omega,
+                                                              omega);
+        ksp.SetOperators(*A, *P);
+        omega_pc = omega;
+        pc_it = -1;
+      }
+      else
+      {
+        Mpi::Print(" Reusing preconditioner from ω/2π = {:.3e} GHz\n",
+                   iodata.DimensionalizeValue(IoData::ValueType::FREQUENCY, omega_pc));
+        ksp.SetOperator(*A);
+      }
     }
-    space_op.GetExcitationVector(omega, RHS);
-    Mpi::Print("\n");
-    ksp.Mult(RHS, E);
-
-    // Compute B = -1/(iω) ∇ x E on the true dofs, and set the internal GridFunctions in
-    // PostOperator for all postprocessing operations.
-    BlockTimer bt0(Timer::POSTPRO);
-    Curl.Mult(E.Real(), B.Real());
-    Curl.Mult(E.Imag(), B.Imag());
-    B *= -1.0 / (1i * omega);
-    post_op.SetEGridFunction(E);
-    post_op.SetBGridFunction(B);
-    post_op.UpdatePorts(space_op.GetLumpedPortOp(), space_op.GetWavePortOp(), omega);
-    const double E_elec = post_op.GetEFieldEnergy();
-    const double E_mag = post_op.GetHFieldEnergy();
-    Mpi::Print(" Sol. ||E|| = {:.6e} (||RHS|| = {:.6e})\n",
-               linalg::Norml2(space_op.GetComm(), E),
-               linalg::Norml2(space_op.GetComm(), RHS));
+    const int n_h = std::min(step - step0, n_h_max);
+    const int ksp_it = ksp.NumTotalMultIterations();
+    std::vector<SMatrixEntry> S;
+    for (int ex = 0; ex < n_ex; ex++)
     {
-      const double J = iodata.DimensionalizeValue(IoData::ValueType::ENERGY, 1.0);
-      Mpi::Print(" Field energy E ({:.3e} J) + H ({:.3e} J) = {:.3e} J\n", E_elec * J,
-                 E_mag * J, (E_elec + E_mag) * J);
-    }
+      if (!excitations.empty())
+      {
+        const auto &[idx, wave] = excitations[ex];
+        Mpi::Print("\n Excitation {:d}/{:d}: {} port {:d}\n", ex + 1, n_ex,
+                   wave ? "wave" : "lumped", idx);
+        SetExcitation(ex);
+      }
+      space_op.GetExcitationVector(omega, RHS);
+      if (n_h > 1 || (n_h > 0 && n_ex > 1))
+      {
+        ExtrapolateSolution(E_h.data() + ex * n_h_max, omega_h.data(), n_h, omega, E);
+      }
+      Mpi::Print("\n");
+      ksp.Mult(RHS, E);
+      if (n_h_max > 0)
+      {
+        const int slot = (step - step0) % n_h_max;
+        E_h[ex * n_h_max + slot] = E;
+        omega_h[slot] = omega;
+      }
+
+      // Compute B = -1/(iω) ∇ x E on the true dofs, and set the internal GridFunctions in
+      // PostOperator for all postprocessing operations.
+      BlockTimer bt0(Timer::POSTPRO);
+      if (!excitations.empty())
+      {
+        post_op.SetDataCollection(ex_output[ex]);
+      }
+      Curl.Mult(E.Real(), B.Real());
+      Curl.Mult(E.Imag(), B.Imag());
+      B *= -1.0 / (1i * omega);
+      post_op.SetEGridFunction(E);
+      post_op.SetBGridFunction(B);
+      post_op.UpdatePorts(space_op.GetLumpedPortOp(), space_op.GetWavePortOp(), omega);
+      const double E_elec = post_op.GetEFieldEnergy();
+      const double E_mag = post_op.GetHFieldEnergy();
+      Mpi::Print(" Sol. ||E|| = {:.6e} (||RHS|| = {:.6e})\n",
+                 linalg::Norml2(space_op.GetComm(), E),
+                 linalg::Norml2(space_op.GetComm(), RHS));
+      {
+        const double J = iodata.DimensionalizeValue(IoData::ValueType::ENERGY, 1.0);
+        Mpi::Print(" Field energy E ({:.3e} J) + H ({:.3e} J) = {:.3e} J\n", E_elec * J,
+                   E_mag * J, (E_elec + E_mag) * J);
+      }
 
-    // Calculate and record the error indicators.
-    Mpi::Print(" Updating solution error estimates\n");
-    estimator.AddErrorIndicator(E, B, E_elec + E_mag, indicator);
+      // Calculate and record the error indicators (summed over all excitations).
+      Mpi::Print(" Updating solution error estimates\n");
+      estimator.AddErrorIndicator(E, B, E_elec + E_mag, indicator);
 
-    // Postprocess S-parameters and optionally write solution to disk.
-    Postprocess(post_op, space_op.GetLumpedPortOp(), space_op.GetWavePortOp(),
-                space_op.GetSurfaceCurrentOp(), step, omega, E_elec, E_mag,
-                (step == n_step - 1) ? &indicator : nullptr);
+      // Postprocess S-parameters and optionally write solution to disk.
+      if (excitations.empty())
+      {
+        Postprocess(post_op, space_op.GetLumpedPortOp(), space_op.GetWavePortOp(),
+                    space_op.GetSurfaceCurrentOp(), step, omega, E_elec, E_mag,
+                    (step == n_step - 1) ? &indicator : nullptr);
+      }
+      else
+      {
+        ex_solver[ex]->Postprocess(post_op, space_op.GetLumpedPortOp(),
+                                   space_op.GetWavePortOp(), space_op.GetSurfaceCurrentOp(),
+                                   step, omega, E_elec, E_mag, nullptr);
+        const auto &[source_idx, wave] = excitations[ex];
+        if (wave)
+        {
+          for (const auto &[idx, data] : space_op.GetWavePortOp())
+          {
+            S.push_back({idx, source_idx,
+                         post_op.GetSParameter(space_op.GetWavePortOp(), idx,
+                                               source_idx)});
+          }
+        }
+        else
+        {
+          for (const auto &[idx, data] : space_op.GetLumpedPortOp())
+          {
+            S.push_back({idx, source_idx,
+                         post_op.GetSParameter(space_op.GetLumpedPortOp(), idx,
+                                               source_idx)});
+          }
+        }
+      }
+    }
+    if (pc_it < 0)
+    {
+      pc_it = std::max(ksp.NumTotalMultIterations() - ksp_it, 1);
+      pc_update = false;
+    }
+    else
+    {
+      pc_update = (ksp.NumTotalMultIterations() - ksp_it > pc_reuse_it_factor * pc_it);
+    }
+    if (!excitations.empty())
+    {
+      BlockTimer bt0(Timer::POSTPRO);
+      PostprocessSMatrix(S, step, omega);
+      if (step == n_step - 1)
+      {
+        post_op.SetDataCollection(0);
+        PostprocessErrorIndicator(post_op, indicator, iodata.solver.driven.delta_post > 0);
+      }
+    }
 
     // Increment frequency.
     step++;
     omega += delta_omega;
   }
+  for (const auto &[idx, wave] : excitations)
+  {
+    if (wave)
+    {
+      space_op.GetWavePortOp().SetExcitation(idx, true);
+    }
+    else
+    {
+      space_op.GetLumpedPortOp().SetExcitation(idx, true);
+    }
+  }
   BlockTimer bt0(Timer::POSTPRO);
   SaveMetadata(ksp);
   return indicator;
@@ -226,6 +775,7 @@ ErrorIndicator DrivenSolver::SweepAdaptive(SpaceOperator &space_op, PostOperator
   }
   max_size = std::min(max_size, n_step - step0);  // Maximum size dictated by sweep
   int convergence_memory = iodata.solver.driven.adaptive_memory;
+  const int batch_size = std::max(iodata.solver.driven.adaptive_batch_size, 1);
 
   // Allocate negative curl matrix for postprocessing the B-field and vectors for the
   // high-dimensional field solution.
@@ -238,111 +788,200 @@ ErrorIndicator DrivenSolver::SweepAdaptive(SpaceOperator &space_op, PostOperator
   Eh = 0.0;
   B = 0.0;
 
-  // Initialize structures for storing and reducing the results of error estimation.
-  TimeDependentFluxErrorEstimator<ComplexVector> estimator(
-      space_op.GetMaterialOp(), space_op.GetNDSpaces(), space_op.GetRTSpaces(),
-      iodata.solver.linear.estimator_tol, iodata.solver.linear.estimator_max_it, 0,
-      iodata.solver.linear.estimator_mg);
-  ErrorIndicator indicator;
-
   // Configure the PROM operator which performs the parameter space sampling and basis
   // construction during the offline phase as well as the PROM solution during the online
-  // phase.
+  // phase. A PROM saved by a previous run can be loaded instead, skipping the offline phase
+  // (and the error estimation, which requires HDM solutions).
+  ErrorIndicator indicator;
+  std::unique_ptr<RomOperator> prom_op;
+  const auto &load_path = iodata.solver.driven.adaptive_load_rom;
   auto t0 = Timer::Now();
   const double f0 = iodata.DimensionalizeValue(IoData::ValueType::FREQUENCY, 1.0);
-  Mpi::Print("\nBeginning PROM construction offline phase:\n"
-             " {:d} points for frequency sweep over [{:.3e}, {:.3e}] GHz\n",
-             n_step - step0, omega0 * f0,
-             (omega0 + (n_step - step0 - 1) * delta_omega) * f0);
-  RomOperator prom_op(iodata, space_op, max_size);
-  space_op.GetWavePortOp().SetSuppressOutput(
-      true);  // Suppress wave port output for offline
-
-  // Initialize the basis with samples from the top and bottom of the frequency
-  // range of interest. Each call for an HDM solution adds the frequency sample to P_S and
-  // removes it from P \ P_S. Timing for the HDM construction and solve is handled inside
-  // of the RomOperator.
-  auto UpdatePROM = [&](double omega)
-  {
-    // Add the HDM solution to the PROM reduced basis.
-    prom_op.UpdatePROM(omega, E);
+  if (!load_path.empty())
+  {
+    Mpi::Print("\nLoading PROM from {}\n", load_path);
+    prom_op = std::make_unique<RomOperator>(space_op, load_path);
+    const auto &z = prom_op->GetSamplePoints();
+    Mpi::Print(" n = {:d}, {:d} frequency samples\n", prom_op->GetReducedDimension(),
+               z.size());
+    utils::PrettyPrint(z, f0, " Sampled frequencies (GHz):");
+    const double omega_min = std::min(omega0, omega0 + (n_step - step0 - 1) * delta_omega);
+    const double omega_max = std::max(omega0, omega0 + (n_step - step0 - 1) * delta_omega);
+    if (omega_min < *std::min_element(z.begin(), z.end()) ||
+        omega_max > *std::max_element(z.begin(), z.end()))
+    {
+      Mpi::Warning("Frequency sweep range [{:.3e}, {:.3e}] GHz extends outside of the "
+                   "sampled range of the loaded PROM, results may be inaccurate!\n",
+                   omega_min * f0, omega_max * f0);
+    }
+  }
+  else
+  {
+    // Initialize structures for storing and reducing the results of error estimation.
+    TimeDependentFluxErrorEstimator<ComplexVector> estimator(
+        space_op.GetMaterialOp(), space_op.GetNDSpaces(), space_op.GetRTSpaces(),
+        iodata.solver.linear.estimator_tol, iodata.solver.linear.estimator_max_it, 0,
+        iodata.solver.linear.estimator_mg);
 
-    // Compute B = -1/(iω) ∇ x E on the true dofs, and set the internal GridFunctions in
-    // PostOperator for energy postprocessing and error estimation.
-    BlockTimer bt0(Timer::POSTPRO);
-    Curl.Mult(E.Real(), B.Real());
-    Curl.Mult(E.Imag(), B.Imag());
-    B *= -1.0 / (1i * omega);
-    post_op.SetEGridFunction(E, false);
-    post_op.SetBGridFunction(B, false);
-    const double E_elec = post_op.GetEFieldEnergy();
-    const double E_mag = post_op.GetHFieldEnergy();
-    estimator.AddErrorIndicator(E, B, E_elec + E_mag, indicator);
-  };
-  prom_op.SolveHDM(omega0, E);
-  UpdatePROM(omega0);
-  prom_op.SolveHDM(omega0 + (n_step - step0 - 1) * delta_omega, E);
-  UpdatePROM(omega0 + (n_step - step0 - 1) * delta_omega);
-
-  // Greedy procedure for basis construction (offline phase). Basis is initialized with
-  // solutions at frequency sweep endpoints.
-  int it = 2, it0 = it, memory = 0;
-  std::vector<double> max_errors = {0.0, 0.0};
-  while (true)
-  {
-    // Compute the location of the maximum error in parameter domain (bounded by the
-    // previous samples).
-    double omega_star = prom_op.FindMaxError()[0];
-
-    // Compute the actual solution error at the given parameter point.
-    prom_op.SolveHDM(omega_star, E);
-    prom_op.SolvePROM(omega_star, Eh);
-    linalg::AXPY(-1.0, E, Eh);
-    max_errors.push_back(linalg::Norml2(space_op.GetComm(), Eh) /
-                         linalg::Norml2(space_op.GetComm(), E));
-    if (max_errors.back() < offline_tol)
-    {
-      if (++memory == convergence_memory)
+    Mpi::Print("\nBeginning PROM construction offline phase:\n"
+               " {:d} points for frequency sweep over [{:.3e}, {:.3e}] GHz\n",
+               n_step - step0, omega0 * f0,
+               (omega0 + (n_step - step0 - 1) * delta_omega) * f0);
+    prom_op = std::make_unique<RomOperator>(iodata, space_op, max_size);
+    space_op.GetWavePortOp().SetSuppressOutput(
+        true);  // Suppress wave port output for offline
+
+    // Initialize the basis with samples from the top and bottom of the frequency
+    // range of interest. Each call for an HDM solution adds the frequency sample to P_S and
+    // removes it from P \ P_S. Timing for the HDM construction and solve is handled inside
+    // of the RomOperator. Batches of HDM solutions are added to the basis at once.
+    std::vector<ComplexVector> E_b;
+    auto ResizeBatch = [&](std::size_t n)
+    {
+      E_b.resize(n);
+      for (auto &Eb : E_b)
       {
-        break;
+        if (Eb.Size() != Curl.Width())
+        {
+          Eb.SetSize(Curl.Width());
+          Eb.UseDevice(true);
+        }
       }
-    }
-    else
+    };
+    auto UpdatePROM = [&](const std::vector<double> &omega)
     {
-      memory = 0;
-    }
-    if (it == max_size)
+      // Add the HDM solutions to the PROM reduced basis.
+      prom_op->UpdatePROM(omega, E_b);
+
+      // Compute B = -1/(iω) ∇ x E on the true dofs, and set the internal GridFunctions in
+      // PostOperator for energy postprocessing and error estimation.
+      BlockTimer bt0(Timer::POSTPRO);
+      for (std::size_t k = 0; k < omega.size(); k++)
+      {
+        Curl.Mult(E_b[k].Real(), B.Real());
+        Curl.Mult(E_b[k].Imag(), B.Imag());
+        B *= -1.0 / (1i * omega[k]);
+        post_op.SetEGridFunction(E_b[k], false);
+        post_op.SetBGridFunction(B, false);
+        const double E_elec = post_op.GetEFieldEnergy();
+        const double E_mag = post_op.GetHFieldEnergy();
+        estimator.AddErrorIndicator(E_b[k], B, E_elec + E_mag, indicator);
+      }
+    };
+    auto SetTelemetryTag = [this](double omega)
     {
-      break;
+      SolverTelemetry::SetTag(
+          "f (GHz)", iodata.DimensionalizeValue(IoData::ValueType::FREQUENCY, omega));
+    };
+    ResizeBatch(1);
+    SetTelemetryTag(omega0);
+    prom_op->SolveHDM(omega0, E_b[0]);
+    UpdatePROM({omega0});
+    SetTelemetryTag(omega0 + (n_step - step0 - 1) * delta_omega);
+    prom_op->SolveHDM(omega0 + (n_step - step0 - 1) * delta_omega, E_b[0]);
+    UpdatePROM({omega0 + (n_step - step0 - 1) * delta_omega});
+
+    // Greedy procedure for basis construction (offline phase). Basis is initialized with
+    // solutions at frequency sweep endpoints. Each greedy iteration samples a batch of up
+    // to batch_size points, with the HDM solves sharing the preconditioner constructed at
+    // the first (largest error) point. The PROM solution at each sampled point is used as
+    // the initial guess for the HDM solve, and the HDM solves are optionally inexact, with
+    // a tolerance proportional to the error estimate from the previous greedy iteration.
+    // The HDM tolerance is floored at the linear solver tolerance and capped at the offline
+    // tolerance, so early iterations with large PROM errors use loose solves while the HDM
+    // solution error never exceeds the level resolved by the convergence check.
+    const double inexact_factor = iodata.solver.driven.adaptive_inexact_factor;
+    int it = 2, it0 = it, memory = 0;
+    std::vector<double> max_errors = {0.0, 0.0};
+    double prev_error = 0.0;
+    while (true)
+    {
+      // Compute the locations of the maximum error in parameter domain (bounded by the
+      // previous samples).
+      const std::vector<double> omega_star =
+          prom_op->FindMaxError(std::min(batch_size, std::max(max_size - it, 1)));
+
+      // Compute the actual solution error at the given parameter points.
+      ResizeBatch(omega_star.size());
+      const double hdm_tol = RomOperator::GetInexactTolerance(
+          inexact_factor, prev_error, iodata.solver.linear.tol, offline_tol);
+      double max_error = 0.0;
+      for (std::size_t k = 0; k < omega_star.size(); k++)
+      {
+        prom_op->SolvePROM(omega_star[k], Eh);
+        E_b[k] = Eh;
+        SetTelemetryTag(omega_star[k]);
+        prom_op->SolveHDM(omega_star[k], E_b[k], k > 0, true, hdm_tol);
+        linalg::AXPY(-1.0, E_b[k], Eh);
+        max_errors.push_back(linalg::Norml2(space_op.GetComm(), Eh) /
+                             linalg::Norml2(space_op.GetComm(), E_b[k]));
+        max_error = std::max(max_error, max_errors.back());
+      }
+      prev_error = max_error;
+      if (max_error < offline_tol)
+      {
+        if (++memory == convergence_memory)
+        {
+          break;
+        }
+      }
+      else
+      {
+        memory = 0;
+      }
+      if (it == max_size)
+      {
+        break;
+      }
+
+      // Sample HDM and add solutions to basis.
+      for (std::size_t k = 0; k < omega_star.size(); k++)
+      {
+        Mpi::Print("\nGreedy iteration {:d} (n = {:d}): ω* = {:.3e} GHz ({:.3e}), error = "
+                   "{:.3e}{}\n",
+                   it - it0 + k + 1, prom_op->GetReducedDimension(), omega_star[k] * f0,
+                   omega_star[k], max_errors[max_errors.size() - omega_star.size() + k],
+                   (memory == 0)
+                       ? ""
+                       : fmt::format(", memory = {:d}/{:d}", memory, convergence_memory));
+      }
+      UpdatePROM(omega_star);
+      it += omega_star.size();
     }
+    Mpi::Print("\nAdaptive sampling{} {:d} frequency samples:\n"
+               " n = {:d}, error = {:.3e}, tol = {:.3e}, memory = {:d}/{:d}\n",
+               (it == max_size) ? " reached maximum" : " converged with", it,
+               prom_op->GetReducedDimension(), max_errors.back(), offline_tol, memory,
+               convergence_memory);
+    utils::PrettyPrint(prom_op->GetSamplePoints(), f0, " Sampled frequencies (GHz):");
+    utils::PrettyPrint(max_errors, 1.0, " Sample errors:");
+    Mpi::Print(" Total offline phase elapsed time: {:.2e} s\n",
+               Timer::Duration(Timer::Now() - t0).count());  // Timing on root
 
-    // Sample HDM and add solution to basis.
-    Mpi::Print("\nGreedy iteration {:d} (n = {:d}): ω* = {:.3e} GHz ({:.3e}), error = "
-               "{:.3e}{}\n",
-               it - it0 + 1, prom_op.GetReducedDimension(), omega_star * f0, omega_star,
-               max_errors.back(),
-               (memory == 0)
-                   ? ""
-                   : fmt::format(", memory = {:d}/{:d}", memory, convergence_memory));
-    UpdatePROM(omega_star);
-    it++;
-  }
-  Mpi::Print("\nAdaptive sampling{} {:d} frequency samples:\n"
-             " n = {:d}, error = {:.3e}, tol = {:.3e}, memory = {:d}/{:d}\n",
-             (it == max_size) ? " reached maximum" : " converged with", it,
-             prom_op.GetReducedDimension(), max_errors.back(), offline_tol, memory,
-             convergence_memory);
-  utils::PrettyPrint(prom_op.GetSamplePoints(), f0, " Sampled frequencies (GHz):");
-  utils::PrettyPrint(max_errors, 1.0, " Sample errors:");
-  Mpi::Print(" Total offline phase elapsed time: {:.2e} s\n",
-             Timer::Duration(Timer::Now() - t0).count());  // Timing on root
+    // Optionally save the PROM for reuse by the online phase of a later run.
+    if (!iodata.solver.driven.adaptive_save_rom.empty())
+    {
+      prom_op->SaveROM(iodata.solver.driven.adaptive_save_rom);
+      Mpi::Print(" Saved PROM to {}\n", iodata.solver.driven.adaptive_save_rom);
+    }
+  }
 
   // XX TODO: Add output of eigenvalue estimates from the PROM system (and nonlinear EVP in
   //          the general case with wave ports, etc.?)
 
-  // Main fast frequency sweep loop (online phase).
+  // Main fast frequency sweep loop (online phase). When possible, the postprocessing
+  // functionals are projected onto the reduced basis so that the PROM solution only needs
+  // to be expanded into the high-dimensional space at steps with field output.
   Mpi::Print("\nBeginning fast frequency sweep online phase\n");
   space_op.GetWavePortOp().SetSuppressOutput(false);  // Disable output suppression
+  bool reduced_post;
+  {
+    BlockTimer bt0(Timer::POSTPRO);
+    reduced_post = post_op.SetReducedBasis(
+        prom_op->GetReducedBasis(), prom_op->GetReducedDimension(), Curl,
+        space_op.GetLumpedPortOp(), space_op.GetWavePortOp());
+  }
+  Eigen::VectorXcd y;
   int step = step0;
   double omega = omega0;
   while (step < n_step)
@@ -352,21 +991,40 @@ ErrorIndicator DrivenSolver::SweepAdaptive(SpaceOperator &space_op, PostOperator
                n_step, freq, Timer::Duration(Timer::Now() - t0).count());
 
     // Assemble and solve the PROM linear system.
-    prom_op.SolvePROM(omega, E);
+    const bool fields = (iodata.solver.driven.delta_post > 0 &&
+                         GetGlobalStep(step) % iodata.solver.driven.delta_post == 0);
+    const bool reduced_step = reduced_post && !fields;
+    if (reduced_step)
+    {
+      prom_op->SolvePROM(omega, y);
+    }
+    else
+    {
+      prom_op->SolvePROM(omega, E);
+    }
     Mpi::Print("\n");
 
     // Compute B = -1/(iω) ∇ x E on the true dofs, and set the internal GridFunctions in
-    // PostOperator for all postprocessing operations.
+    // PostOperator for all postprocessing operations. For reduced-order postprocessing,
+    // ||E|| = ||y|| since the basis is orthonormal.
     BlockTimer bt0(Timer::POSTPRO);
-    Curl.Mult(E.Real(), B.Real());
-    Curl.Mult(E.Imag(), B.Imag());
-    B *= -1.0 / (1i * omega);
-    post_op.SetEGridFunction(E);
-    post_op.SetBGridFunction(B);
+    if (reduced_step)
+    {
+      post_op.SetReducedSolution(y, omega);
+    }
+    else
+    {
+      Curl.Mult(E.Real(), B.Real());
+      Curl.Mult(E.Imag(), B.Imag());
+      B *= -1.0 / (1i * omega);
+      post_op.SetEGridFunction(E);
+      post_op.SetBGridFunction(B);
+    }
     post_op.UpdatePorts(space_op.GetLumpedPortOp(), space_op.GetWavePortOp(), omega);
     const double E_elec = post_op.GetEFieldEnergy();
     const double E_mag = post_op.GetHFieldEnergy();
-    Mpi::Print(" Sol. ||E|| = {:.6e}\n", linalg::Norml2(space_op.GetComm(), E));
+    Mpi::Print(" Sol. ||E|| = {:.6e}\n",
+               reduced_step ? y.norm() : linalg::Norml2(space_op.GetComm(), E));
     {
       const double J = iodata.DimensionalizeValue(IoData::ValueType::ENERGY, 1.0);
       Mpi::Print(" Field energy E ({:.3e} J) + H ({:.3e} J) = {:.3e} J\n", E_elec * J,
@@ -376,14 +1034,17 @@ ErrorIndicator DrivenSolver::SweepAdaptive(SpaceOperator &space_op, PostOperator
     // Postprocess S-parameters and optionally write solution to disk.
     Postprocess(post_op, space_op.GetLumpedPortOp(), space_op.GetWavePortOp(),
                 space_op.GetSurfaceCurrentOp(), step, omega, E_elec, E_mag,
-                (step == n_step - 1) ? &indicator : nullptr);
+                (step == n_step - 1 && load_path.empty()) ? &indicator : nullptr);
 
     // Increment frequency.
     step++;
     omega += delta_omega;
   }
   BlockTimer bt0(Timer::POSTPRO);
-  SaveMetadata(prom_op.GetLinearSolver());
+  if (const auto *ksp = prom_op->GetLinearSolver())
+  {
+    SaveMetadata(*ksp);
+  }
   return indicator;
 }
 
@@ -423,11 +1084,13 @@ void DrivenSolver::Postprocess(const PostOperator &post_op,
   PostprocessDomains(post_op, "f (GHz)", step, freq, E_elec, E_mag, E_cap, E_ind);
   PostprocessSurfaces(post_op, "f (GHz)", step, freq, E_elec + E_cap, E_mag + E_ind);
   PostprocessProbes(post_op, "f (GHz)", step, freq);
-  if (iodata.solver.driven.delta_post > 0 && step % iodata.solver.driven.delta_post == 0)
+  const int global_step = GetGlobalStep(step);
+  if (iodata.solver.driven.delta_post > 0 &&
+      global_step % iodata.solver.driven.delta_post == 0)
   {
     Mpi::Print("\n");
-    PostprocessFields(post_op, step / iodata.solver.driven.delta_post, freq);
-    Mpi::Print(" Wrote fields to disk at step {:d}\n", step + 1);
+    PostprocessFields(post_op, global_step / iodata.solver.driven.delta_post, freq);
+    Mpi::Print(" Wrote fields to disk at step {:d}\n", global_step + 1);
   }
   if (indicator)
   {
@@ -762,4 +1425,46 @@ void DrivenSolver::PostprocessSParameters(const PostOperator &post_op,
   }
 }
 
+void DrivenSolver::PostprocessSMatrix(const std::vector<SMatrixEntry> &S, int step,
+                                      double omega) const
+{
+  // Postprocess the full S-matrix computed from separate port excitations, storing |S_ij|
+  // and arg(S_ij) in dB and degrees, respectively, ordered by excitation column.
+  if (!root || post_dir.length() == 0 || S.empty())
+  {
+    return;
+  }
+  std::string path = post_dir + "port-S.csv";
+  auto output = OutputFile(path, (step > 0));
+  if (step == 0)
+  {
+    output.print("{:>{}s},", "f (GHz)", table.w1);
+    for (std::size_t k = 0; k < S.size(); k++)
+    {
+      std::string str =
+          "S[" + std::to_string(S[k].idx) + "][" + std::to_string(S[k].source_idx) + "]";
+      // clang-format off
+      output.print("{:>{}s},{:>{}s}{}",
+                   "|" + str + "| (dB)", table.w,
+                   "arg(" + str + ") (deg.)", table.w,
+                   (k == S.size() - 1) ? "" : ",");
+      // clang-format on
+    }
+    output.print("\n");
+  }
+  output.print("{:{}.{}e},",
+               iodata.DimensionalizeValue(IoData::ValueType::FREQUENCY, omega), table.w1,
+               table.p1);
+  for (std::size_t k = 0; k < S.size(); k++)
+  {
+    // clang-format off
+    output.print("{:>+{}.{}e},{:>+{}.{}e}{}",
+                 20.0 * std::log10(std::abs(S[k].S_ij)), table.w, table.p,
+                 std::arg(S[k].S_ij) * 180.0 / M_PI, table.w, table.p,
+                 (k == S.size() - 1) ? "" : ",");
+    // clang-format on
+  }
+  output.print("\n");
+}
+
 }  // namespace palace
@@ -4,7 +4,9 @@
 #ifndef PALACE_DRIVERS_DRIVEN_SOLVER_HPP
 #define PALACE_DRIVERS_DRIVEN_SOLVER_HPP
 
+#include <complex>
 #include <memory>
+#include <string>
 #include <vector>
 #include "drivers/basesolver.hpp"
 
@@ -25,6 +27,21 @@ class WavePortOperator;
 class DrivenSolver : public BaseSolver
 {
 private:
+  // Entry of the S-matrix computed from separate port excitations.
+  struct SMatrixEntry
+  {
+    int idx, source_idx;
+    std::complex<double> S_ij;
+  };
+
+  // Global index of the first frequency step and stride between frequency steps, for a
+  // nested sweep over a strided subset of the frequency samples by a frequency group.
+  int step_offset = 0, step_stride = 1;
+
+  // Return the index of the given frequency step in the full frequency sweep, which
+  // determines the steps with field output and their numbering.
+  int GetGlobalStep(int step) const { return step_offset + step * step_stride; }
+
   int GetNumSteps(double start, double end, double delta) const;
 
   ErrorIndicator SweepUniform(SpaceOperator &space_op, PostOperator &post_op, int n_step,
@@ -51,11 +68,23 @@ private:
                               const WavePortOperator &wave_port_op, int step,
                               double omega) const;
 
+  void PostprocessSMatrix(const std::vector<SMatrixEntry> &S, int step,
+                          double omega) const;
+
+  std::pair<ErrorIndicator, long long int>
+  SolveFrequencyGroups(const std::vector<std::unique_ptr<Mesh>> &mesh) const;
+
   std::pair<ErrorIndicator, long long int>
   Solve(const std::vector<std::unique_ptr<Mesh>> &mesh) const override;
 
 public:
   using BaseSolver::BaseSolver;
+
+  // Merge the postprocessed results written by each frequency group to its subdirectory of
+  // the output directory into the top-level output files (appending to them for a
+  // restarted sweep). Field output and the metadata for each group remain in the group
+  // subdirectories.
+  static void MergeGroupPostprocessing(const std::string &output, int n_group, bool append);
 };
 
 }  // namespace palace
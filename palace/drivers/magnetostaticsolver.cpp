@@ -9,6 +9,7 @@
 #include "linalg/errorestimator.hpp"
 #include "linalg/ksp.hpp"
 #include "linalg/operator.hpp"
+#include "linalg/telemetry.hpp"
 #include "models/curlcurloperator.hpp"
 #include "models/postoperator.hpp"
 #include "models/surfacecurrentoperator.hpp"
@@ -62,6 +63,7 @@ MagnetostaticSolver::Solve(const std::vector<std::unique_ptr<Mesh>> &mesh) const
   {
     Mpi::Print("\nIt {:d}/{:d}: Index = {:d} (elapsed time = {:.2e} s)\n", step + 1, n_step,
                idx, Timer::Duration(Timer::Now() - t0).count());
+    SolverTelemetry::SetTag("Source", idx);
 
     // Form and solve the linear system for a prescribed current on the specified source.
     Mpi::Print("\n");
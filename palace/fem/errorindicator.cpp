@@ -47,4 +47,31 @@ void ErrorIndicator::AddIndicator(const Vector &indicator)
   n += 1;
 }
 
+void ErrorIndicator::Reduce(MPI_Comm comm)
+{
+  // Each running average is weighted by its number of samples, consistent with the
+  // reduction in AddIndicator: eₖ = √(∑ₘ Nₘ eₖₘ² / ∑ₘ Nₘ). The sample count is reduced in
+  // the same message as the weighted indicators.
+  const int N = local.Size();
+  auto *HL = local.HostReadWrite();
+  for (int i = 0; i < N; i++)
+  {
+    HL[i] = HL[i] * HL[i] * n;
+  }
+  double n_tot = n;
+  ReductionBatch<double> batch;
+  batch.Add(n_tot);
+  batch.Add(N, HL);
+  batch.Reduce(comm);
+  if (n_tot == 0)
+  {
+    return;
+  }
+  for (int i = 0; i < N; i++)
+  {
+    HL[i] = std::sqrt(HL[i] / n_tot);
+  }
+  n = static_cast<int>(n_tot);
+}
+
 }  // namespace palace
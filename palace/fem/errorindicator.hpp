@@ -36,6 +36,11 @@ public:
   // Add an indicator to the running total.
   void AddIndicator(const Vector &indicator);
 
+  // Combine the running totals of indicators computed on identically partitioned meshes
+  // across the processes of the given communicator (for example, one process from each
+  // group of a frequency-parallel sweep).
+  void Reduce(MPI_Comm comm);
+
   // Return the local error indicator.
   const auto &Local() const { return local; }
 
@@ -3,6 +3,7 @@
 
 #include "fespace.hpp"
 
+#include <algorithm>
 #include "fem/bilinearform.hpp"
 #include "fem/integrator.hpp"
 #include "fem/libceed/basis.hpp"
@@ -12,6 +13,87 @@
 namespace palace
 {
 
+std::vector<std::vector<int>> FiniteElementSpace::GetPatchTrueDofs(bool vertex) const
+{
+  // Patches only include the true dofs owned by this process, so patches at process
+  // boundaries are truncated.
+  auto &pmesh = mesh.Get();
+  std::vector<std::vector<int>> patches;
+  mfem::Array<int> dofs;
+  auto AddDofs = [this, &dofs](std::vector<int> &patch)
+  {
+    for (const auto dof : dofs)
+    {
+      const int tdof = fespace.GetLocalTDofNumber((dof >= 0) ? dof : -1 - dof);
+      if (tdof >= 0)
+      {
+        patch.push_back(tdof);
+      }
+    }
+  };
+  if (!vertex)
+  {
+    patches.resize(pmesh.GetNE());
+    for (int e = 0; e < pmesh.GetNE(); e++)
+    {
+      fespace.GetElementDofs(e, dofs);
+      AddDofs(patches[e]);
+    }
+  }
+  else
+  {
+    std::unique_ptr<mfem::Table> vert_elem(pmesh.GetVertexToElementTable());
+    mfem::Array<int> entities, ori, verts;
+    patches.resize(pmesh.GetNV());
+    for (int v = 0; v < pmesh.GetNV(); v++)
+    {
+      auto &patch = patches[v];
+      fespace.GetVertexDofs(v, dofs);
+      AddDofs(patch);
+      for (int k = 0; k < vert_elem->RowSize(v); k++)
+      {
+        const int e = vert_elem->GetRow(v)[k];
+        pmesh.GetElementEdges(e, entities, ori);
+        for (const auto edge : entities)
+        {
+          pmesh.GetEdgeVertices(edge, verts);
+          if (verts.Find(v) >= 0)
+          {
+            fespace.GetEdgeInteriorDofs(edge, dofs);
+            AddDofs(patch);
+          }
+        }
+        if (pmesh.Dimension() == 3)
+        {
+          pmesh.GetElementFaces(e, entities, ori);
+          for (const auto face : entities)
+          {
+            pmesh.GetFaceVertices(face, verts);
+            if (verts.Find(v) >= 0)
+            {
+              fespace.GetFaceInteriorDofs(face, dofs);
+              AddDofs(patch);
+            }
+          }
+        }
+        fespace.GetElementInteriorDofs(e, dofs);
+        AddDofs(patch);
+      }
+    }
+  }
+
+  // Remove duplicates (from entities shared by elements) and empty patches.
+  for (auto &patch : patches)
+  {
+    std::sort(patch.begin(), patch.end());
+    patch.erase(std::unique(patch.begin(), patch.end()), patch.end());
+  }
+  patches.erase(std::remove_if(patches.begin(), patches.end(),
+                               [](const std::vector<int> &patch) { return patch.empty(); }),
+                patches.end());
+  return patches;
+}
+
 CeedBasis FiniteElementSpace::GetCeedBasis(Ceed ceed, mfem::Geometry::Type geom) const
 {
   auto it = basis.find(ceed);
@@ -114,6 +114,11 @@ public:
     return G ? *G : BuildDiscreteInterpolator();
   }
 
+  // Return the lists of local true dofs for the overlapping patches used by patch
+  // smoothers: either the closure of each element, or the star of each vertex (dofs on the
+  // vertex and on the interiors of the edges, faces, and elements which contain it).
+  std::vector<std::vector<int>> GetPatchTrueDofs(bool vertex) const;
+
   // Return the basis object for elements of the given element geometry type.
   CeedBasis GetCeedBasis(Ceed ceed, mfem::Geometry::Type geom) const;
 
@@ -283,6 +288,16 @@ public:
     }
     return G_;
   }
+
+  std::vector<std::vector<std::vector<int>>> GetPatchTrueDofs(bool vertex) const
+  {
+    std::vector<std::vector<std::vector<int>>> patches(GetNumLevels());
+    for (std::size_t l = 1; l < patches.size(); l++)  // No patches for coarsest level
+    {
+      patches[l] = GetFESpaceAtLevel(l).GetPatchTrueDofs(vertex);
+    }
+    return patches;
+  }
 };
 
 }  // namespace palace
@@ -0,0 +1,133 @@
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#include "agglomeration.hpp"
+
+#include <algorithm>
+#include "utils/communication.hpp"
+
+namespace palace
+{
+
+AgglomerationSolver::AgglomerationSolver(
+    MPI_Comm comm, int num_procs,
+    const std::function<std::unique_ptr<mfem::Solver>(MPI_Comm)> &make_solver, int print)
+  : mfem::Solver(), comm(comm), agg_comm(MPI_COMM_NULL), group_comm(MPI_COMM_NULL),
+    num_procs(std::clamp(num_procs, 1, Mpi::Size(comm))), print(print)
+{
+  // Every stride-th process is active, and the last active process also takes over any
+  // remaining processes at the end of the communicator.
+  const int rank = Mpi::Rank(comm);
+  const int stride = Mpi::Size(comm) / this->num_procs;
+  const int group = std::min(rank / stride, this->num_procs - 1);
+  const bool active = (rank == group * stride);
+  MPI_Comm_split(comm, active ? 0 : MPI_UNDEFINED, rank, &agg_comm);
+  MPI_Comm_split(comm, group, rank, &group_comm);
+  if (active)
+  {
+    solver = make_solver(agg_comm);
+  }
+}
+
+AgglomerationSolver::~AgglomerationSolver()
+{
+  // The solver and matrix for the agglomerated problem reference the communicator.
+  solver.reset();
+  A.reset();
+  if (agg_comm != MPI_COMM_NULL)
+  {
+    MPI_Comm_free(&agg_comm);
+  }
+  MPI_Comm_free(&group_comm);
+}
+
+void AgglomerationSolver::SetOperator(const Operator &op)
+{
+  const auto *A_op = dynamic_cast<const mfem::HypreParMatrix *>(&op);
+  MFEM_VERIFY(A_op && A_op->GetGlobalNumRows() == A_op->GetGlobalNumCols(),
+              "AgglomerationSolver requires a square HypreParMatrix operator!");
+  height = A_op->Height();
+  width = A_op->Width();
+
+  // Each active process owns the rows of its group. The rows of the inactive processes are
+  // empty and placed at the end of the group, which keeps the row partition contiguous.
+  int n = 0;
+  MPI_Reduce(&height, &n, 1, MPI_INT, MPI_SUM, 0, group_comm);
+  n = (agg_comm != MPI_COMM_NULL) ? n : 0;
+  const HYPRE_BigInt glob_n = A_op->GetGlobalNumRows();
+  HYPRE_BigInt loc_n = n, rows[2];
+  MPI_Scan(&loc_n, &rows[1], 1, mpi::DataType<HYPRE_BigInt>(), MPI_SUM, comm);
+  rows[0] = rows[1] - loc_n;
+  {
+    mfem::Array<int> I(n + 1);
+    mfem::Array<HYPRE_BigInt> J(n);
+    mfem::Vector data(n);
+    for (int i = 0; i < n; i++)
+    {
+      I[i] = i;
+      J[i] = rows[0] + i;
+    }
+    I[n] = n;
+    data = 1.0;
+    HYPRE_BigInt cols[2] = {A_op->GetColStarts()[0], A_op->GetColStarts()[1]};
+    Q = std::make_unique<mfem::HypreParMatrix>(comm, n, glob_n, glob_n, I.GetData(),
+                                               J.GetData(), data.GetData(), rows, cols);
+  }
+
+  // Redistribute the matrix, then construct it on the communicator of the active processes
+  // from the local rows, with global column indices.
+  std::unique_ptr<mfem::HypreParMatrix> QT(Q->Transpose());
+  std::unique_ptr<mfem::HypreParMatrix> A_red(mfem::RAP(A_op, QT.get()));
+  if (solver)
+  {
+    mfem::SparseMatrix loc;
+    A_red->HostRead();
+    A_red->MergeDiagAndOffd(loc);
+    mfem::Array<HYPRE_BigInt> J(loc.NumNonZeroElems());
+    std::copy(loc.GetJ(), loc.GetJ() + J.Size(), J.begin());
+    A = std::make_unique<mfem::HypreParMatrix>(agg_comm, n, glob_n, glob_n, loc.GetI(),
+                                               J.GetData(), loc.GetData(), rows, rows);
+    solver->SetOperator(*A);
+  }
+
+  if (print > 0)
+  {
+    Mpi::Print(comm, " Agglomerated solve: {:d} unknowns on {:d}/{:d} processes\n", glob_n,
+               num_procs, Mpi::Size(comm));
+  }
+}
+
+void AgglomerationSolver::ArrayMult(const mfem::Array<const Vector *> &X,
+                                    mfem::Array<Vector *> &Y) const
+{
+  // Redistribute the right-hand sides, solve on the active processes, and redistribute the
+  // solutions back.
+  const int n = X.Size();
+  if (static_cast<int>(xa.size()) < n)
+  {
+    xa.resize(n);
+    ya.resize(n);
+  }
+  mfem::Array<const Vector *> XA(n);
+  mfem::Array<Vector *> YA(n);
+  for (int j = 0; j < n; j++)
+  {
+    xa[j].SetSize(Q->Height());
+    ya[j].SetSize(Q->Height());
+    xa[j].UseDevice(true);
+    ya[j].UseDevice(true);
+    Q->Mult(*X[j], xa[j]);
+    XA[j] = &xa[j];
+    YA[j] = &ya[j];
+  }
+  if (solver)
+  {
+    solver->ArrayMult(XA, YA);
+  }
+  for (int j = 0; j < n; j++)
+  {
+    Q->MultTranspose(ya[j], *Y[j]);
+  }
+}
+
+}  // namespace palace
@@ -0,0 +1,78 @@
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef PALACE_LINALG_AGGLOMERATION_HPP
+#define PALACE_LINALG_AGGLOMERATION_HPP
+
+#include <functional>
+#include <memory>
+#include <vector>
+#include <mfem.hpp>
+#include "linalg/operator.hpp"
+#include "linalg/vector.hpp"
+
+namespace palace
+{
+
+//
+// Wrapper for a solver which redistributes the parallel assembled matrix onto a subset of
+// the processes before solving. The active processes are spread evenly across the
+// communicator, and each one takes over the rows of the inactive processes which follow it,
+// so the global ordering of the unknowns is unchanged. This is intended for coarse-level
+// solves in multigrid, where there are too few unknowns per process for the solver to scale
+// and the solve is dominated by communication latency.
+//
+class AgglomerationSolver : public mfem::Solver
+{
+private:
+  MPI_Comm comm;
+
+  // Communicator for the processes taking part in the solve (MPI_COMM_NULL on inactive
+  // processes), and communicator for each active process with the inactive processes whose
+  // rows it takes over.
+  MPI_Comm agg_comm, group_comm;
+
+  // Number of active processes.
+  int num_procs;
+
+  // Redistribution from the original row partition to the agglomerated one.
+  std::unique_ptr<mfem::HypreParMatrix> Q;
+
+  // Agglomerated system matrix on the active processes.
+  std::unique_ptr<mfem::HypreParMatrix> A;
+
+  // Solver for the agglomerated problem (nullptr on inactive processes).
+  std::unique_ptr<mfem::Solver> solver;
+
+  // Temporary vectors for the agglomerated problems.
+  mutable std::vector<Vector> xa, ya;
+
+  int print;
+
+public:
+  // The solver for the agglomerated problem is constructed by calling make_solver with the
+  // communicator of the active processes.
+  AgglomerationSolver(
+      MPI_Comm comm, int num_procs,
+      const std::function<std::unique_ptr<mfem::Solver>(MPI_Comm)> &make_solver,
+      int print);
+  ~AgglomerationSolver() override;
+
+  void SetOperator(const Operator &op) override;
+
+  void Mult(const Vector &x, Vector &y) const override
+  {
+    mfem::Array<const Vector *> X(1);
+    mfem::Array<Vector *> Y(1);
+    X[0] = &x;
+    Y[0] = &y;
+    ArrayMult(X, Y);
+  }
+
+  void ArrayMult(const mfem::Array<const Vector *> &X,
+                 mfem::Array<Vector *> &Y) const override;
+};
+
+}  // namespace palace
+
+#endif  // PALACE_LINALG_AGGLOMERATION_HPP
@@ -11,20 +11,24 @@ namespace palace
 namespace
 {
 
-double GetLambdaMax(MPI_Comm comm, const Operator &A, const Vector &dinv)
+// The power iteration is warm started from the dominant eigenvector of the previous
+// operator, if available. For a sequence of operators which change slowly (frequency
+// sweeps or time step updates), this only requires a few iterations.
+double GetLambdaMax(MPI_Comm comm, const Operator &A, const Vector &dinv, Vector &u)
 {
   // Assumes A SPD (diag(A) > 0) to use Hermitian eigenvalue solver.
   DiagonalOperator Dinv(dinv);
   ProductOperator DinvA(Dinv, A);
-  return linalg::SpectralNorm(comm, DinvA, true);
+  return linalg::SpectralNorm(comm, DinvA, u, true);
 }
 
-double GetLambdaMax(MPI_Comm comm, const ComplexOperator &A, const ComplexVector &dinv)
+double GetLambdaMax(MPI_Comm comm, const ComplexOperator &A, const ComplexVector &dinv,
+                    ComplexVector &u)
 {
   // Assumes A SPD (diag(A) > 0) to use Hermitian eigenvalue solver.
   ComplexDiagonalOperator Dinv(dinv);
   ComplexProductOperator DinvA(Dinv, A);
-  return linalg::SpectralNorm(comm, DinvA, A.IsReal());
+  return linalg::SpectralNorm(comm, DinvA, u, A.IsReal());
 }
 
 template <bool Transpose = false>
@@ -179,7 +183,7 @@ void ChebyshevSmoother<OperType>::SetOperator(const OperType &op)
 
   // Set up Chebyshev coefficients using the computed maximum eigenvalue estimate. See
   // mfem::OperatorChebyshevSmoother or Adams et al. (2003).
-  lambda_max = sf_max * GetLambdaMax(comm, *A, dinv);
+  lambda_max = sf_max * GetLambdaMax(comm, *A, dinv, u_max);
   MFEM_VERIFY(lambda_max > 0.0,
               "Encountered zero maximum eigenvalue in Chebyshev smoother!");
 
@@ -246,7 +250,7 @@ void ChebyshevSmoother1stKind<OperType>::SetOperator(const OperType &op)
   {
     sf_min = 1.69 / (std::pow(order, 1.68) + 2.11 * order + 1.98);
   }
-  const double lambda_max = sf_max * GetLambdaMax(comm, *A, dinv);
+  const double lambda_max = sf_max * GetLambdaMax(comm, *A, dinv, u_max);
   MFEM_VERIFY(lambda_max > 0.0,
               "Encountered zero maximum eigenvalue in Chebyshev smoother!");
   const double lambda_min = sf_min * lambda_max;
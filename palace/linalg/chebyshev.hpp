@@ -40,6 +40,10 @@ private:
   // Maximum operator eigenvalue for Chebyshev polynomial smoothing.
   double lambda_max, sf_max;
 
+  // Dominant eigenvector estimate, kept to warm start the eigenvalue estimate for updated
+  // operators.
+  VecType u_max;
+
   // Temporary vector for smoother application.
   mutable VecType d, r;
 
@@ -104,6 +108,10 @@ private:
   // polynomial smoothing.
   double theta, delta, sf_max, sf_min;
 
+  // Dominant eigenvector estimate, kept to warm start the eigenvalue estimate for updated
+  // operators.
+  VecType u_max;
+
   // Temporary vector for smoother application.
   mutable VecType d, r;
 
@@ -6,6 +6,7 @@
 #include <mfem.hpp>
 #include "linalg/chebyshev.hpp"
 #include "linalg/distrelaxation.hpp"
+#include "linalg/patch.hpp"
 #include "linalg/rap.hpp"
 #include "utils/timer.hpp"
 
@@ -17,8 +18,11 @@ GeometricMultigridSolver<OperType>::GeometricMultigridSolver(
     MPI_Comm comm, std::unique_ptr<Solver<OperType>> &&coarse_solver,
     const std::vector<const Operator *> &P, const std::vector<const Operator *> *G,
     int cycle_it, int smooth_it, int cheby_order, double cheby_sf_max, double cheby_sf_min,
-    bool cheby_4th_kind)
-  : Solver<OperType>(), pc_it(cycle_it), P(P.begin(), P.end()), A(P.size() + 1),
+    bool cheby_4th_kind, CycleType cycle_type,
+    const std::vector<int> &smooth_it_levels,
+    const std::vector<std::vector<std::vector<int>>> *patches)
+  : Solver<OperType>(), pc_it(cycle_it), cycle_type(cycle_type), P(P.begin(), P.end()),
+    A(P.size() + 1),
     dbc_tdof_lists(P.size()), B(P.size() + 1), X(P.size() + 1), Y(P.size() + 1),
     R(P.size() + 1), use_timer(false)
 {
@@ -30,24 +34,37 @@ GeometricMultigridSolver<OperType>::GeometricMultigridSolver(
   MFEM_VERIFY(!G || G->size() == n_levels,
               "Invalid input for distributive relaxation smoother auxiliary space transfer "
               "operators (mismatch in number of levels)!");
+  MFEM_VERIFY(!patches || patches->size() == n_levels,
+              "Invalid input for patch smoother patches (mismatch in number of levels)!");
 
   // Use the supplied level 0 (coarse) solver.
   B[0] = std::move(coarse_solver);
 
-  // Configure level smoothers. Use distributive relaxation smoothing if an auxiliary
-  // finite element space was provided.
+  // Configure level smoothers. Use patch smoothing if patches were provided, otherwise
+  // use distributive relaxation smoothing if an auxiliary finite element space was
+  // provided. The number of smoothing iterations per level can be specified starting from
+  // the finest level.
   for (std::size_t l = 1; l < n_levels; l++)
   {
-    if (G)
+    const std::size_t l_fine = n_levels - 1 - l;
+    const int smooth_it_l =
+        (l_fine < smooth_it_levels.size()) ? smooth_it_levels[l_fine] : smooth_it;
+    MFEM_VERIFY(smooth_it_l > 0,
+                "Number of multigrid smoothing iterations must be positive on all levels!");
+    if (patches)
+    {
+      B[l] = std::make_unique<PatchSmoother<OperType>>(comm, (*patches)[l], smooth_it_l);
+    }
+    else if (G)
     {
       const int cheby_smooth_it = 1;
       B[l] = std::make_unique<DistRelaxationSmoother<OperType>>(
-          comm, *(*G)[l], smooth_it, cheby_smooth_it, cheby_order, cheby_sf_max,
+          comm, *(*G)[l], smooth_it_l, cheby_smooth_it, cheby_order, cheby_sf_max,
           cheby_sf_min, cheby_4th_kind);
     }
     else
     {
-      const int cheby_smooth_it = smooth_it;
+      const int cheby_smooth_it = smooth_it_l;
       if (cheby_4th_kind)
       {
         B[l] = std::make_unique<ChebyshevSmoother<OperType>>(comm, cheby_smooth_it,
@@ -132,11 +149,19 @@ void GeometricMultigridSolver<OperType>::Mult(const VecType &x, VecType &y) cons
   MFEM_ASSERT(n_levels > 1 || pc_it == 1,
               "Single-level geometric multigrid will not work with multiple iterations!");
 
-  // Apply V-cycle. The initial guess for y is zero'd at the first pre-smooth iteration.
+  // Apply the multigrid cycle. The initial guess for y is zero'd at the first pre-smooth
+  // iteration.
   X.back() = x;
   for (int it = 0; it < pc_it; it++)
   {
-    VCycle(n_levels - 1, (it > 0));
+    if (cycle_type == CycleType::ADDITIVE && n_levels > 1)
+    {
+      AdditiveCycle(it > 0);
+    }
+    else
+    {
+      Cycle(n_levels - 1, (it > 0), cycle_type);
+    }
   }
   y = Y.back();
 }
@@ -169,7 +194,8 @@ inline void RealMultTranspose(const Operator &op, const ComplexVector &x, Comple
 }  // namespace
 
 template <typename OperType>
-void GeometricMultigridSolver<OperType>::VCycle(int l, bool initial_guess) const
+void GeometricMultigridSolver<OperType>::Cycle(int l, bool initial_guess,
+                                               CycleType type) const
 {
   // Pre-smooth, with zero initial guess (Y = 0 set inside). This is the coarse solve at
   // level 0. Important to note that the smoothers must respect the initial guess flag
@@ -187,13 +213,21 @@ void GeometricMultigridSolver<OperType>::VCycle(int l, bool initial_guess) const
   A[l]->Mult(Y[l], R[l]);
   linalg::AXPBY(1.0, X[l], -1.0, R[l]);
 
-  // Coarse grid correction.
+  // Restrict the residual.
   RealMultTranspose(*P[l - 1], R[l], X[l - 1]);
   if (dbc_tdof_lists[l - 1])
   {
     linalg::SetSubVector(X[l - 1], *dbc_tdof_lists[l - 1], 0.0);
   }
-  VCycle(l - 1, false);
+
+  // Coarse grid correction. A W-cycle visits each coarser level twice, and an F-cycle
+  // follows the recursive F-cycle with a V-cycle. Repeating the coarse solve is skipped
+  // since it is exact.
+  Cycle(l - 1, false, type);
+  if ((type == CycleType::W || type == CycleType::F) && l > 1)
+  {
+    Cycle(l - 1, true, (type == CycleType::W) ? CycleType::W : CycleType::V);
+  }
 
   // Prolongate and add.
   RealMult(*P[l - 1], Y[l - 1], R[l]);
@@ -204,6 +238,49 @@ void GeometricMultigridSolver<OperType>::VCycle(int l, bool initial_guess) const
   B[l]->MultTranspose2(X[l], Y[l], R[l]);
 }
 
+template <typename OperType>
+void GeometricMultigridSolver<OperType>::AdditiveCycle(bool initial_guess) const
+{
+  // Compute the fine level residual and restrict it to all coarser levels.
+  const int l_max = static_cast<int>(A.size()) - 1;
+  if (initial_guess)
+  {
+    A[l_max]->Mult(Y[l_max], R[l_max]);
+    linalg::AXPBY(1.0, X[l_max], -1.0, R[l_max]);
+  }
+  for (int l = l_max; l > 0; l--)
+  {
+    RealMultTranspose(*P[l - 1], (l == l_max && initial_guess) ? R[l] : X[l], X[l - 1]);
+    if (dbc_tdof_lists[l - 1])
+    {
+      linalg::SetSubVector(X[l - 1], *dbc_tdof_lists[l - 1], 0.0);
+    }
+  }
+
+  // Smooth on all levels and solve on the coarse level. The level corrections are
+  // independent of each other (the fine level smoother with a nonzero initial guess uses
+  // the residual for the current iterate, which is the same one which was restricted).
+  B[l_max]->SetInitialGuess(initial_guess);
+  B[l_max]->Mult2(X[l_max], Y[l_max], R[l_max]);
+  for (int l = l_max - 1; l > 0; l--)
+  {
+    B[l]->SetInitialGuess(false);
+    B[l]->Mult2(X[l], Y[l], R[l]);
+  }
+  {
+    BlockTimer bt(Timer::KSP_COARSE_SOLVE, use_timer);
+    B[0]->SetInitialGuess(false);
+    B[0]->Mult(X[0], Y[0]);
+  }
+
+  // Prolongate and add the corrections from coarse to fine.
+  for (int l = 1; l <= l_max; l++)
+  {
+    RealMult(*P[l - 1], Y[l - 1], R[l]);
+    Y[l] += R[l];
+  }
+}
+
 template class GeometricMultigridSolver<Operator>;
 template class GeometricMultigridSolver<ComplexOperator>;
 
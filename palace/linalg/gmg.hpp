@@ -25,16 +25,21 @@ namespace palace
 //
 // Geometric multigrid preconditioner using a given coarse solver for the provided
 // hierarchy of finite element spaces. Optionally can be configured to use auxiliary space
-// smoothing at each level.
+// or patch smoothing at each level. Supports multiplicative V-, W-, and F-cycles as well as
+// an additive (BPX-like) variant where the smoothing on all levels is independent.
 //
 template <typename OperType>
 class GeometricMultigridSolver : public Solver<OperType>
 {
   using VecType = typename Solver<OperType>::VecType;
 
+public:
+  using CycleType = config::LinearSolverData::MultigridCycleType;
+
 private:
-  // Number of V-cycles per preconditioner application.
+  // Number of cycles per preconditioner application, and the cycle type.
   const int pc_it;
+  const CycleType cycle_type;
 
   // Prolongation operators (not owned).
   std::vector<const Operator *> P;
@@ -53,24 +58,34 @@ private:
   // Enable timer contribution for Timer::KSP_COARSE_SOLVE.
   bool use_timer;
 
-  // Internal function to perform a single V-cycle iteration.
-  void VCycle(int l, bool initial_guess) const;
+  // Internal function to perform a single V-, W-, or F-cycle iteration.
+  void Cycle(int l, bool initial_guess, CycleType type) const;
+
+  // Internal function to perform a single additive cycle iteration.
+  void AdditiveCycle(bool initial_guess) const;
 
 public:
   GeometricMultigridSolver(MPI_Comm comm, std::unique_ptr<Solver<OperType>> &&coarse_solver,
                            const std::vector<const Operator *> &P,
                            const std::vector<const Operator *> *G, int cycle_it,
                            int smooth_it, int cheby_order, double cheby_sf_max,
-                           double cheby_sf_min, bool cheby_4th_kind);
+                           double cheby_sf_min, bool cheby_4th_kind,
+                           CycleType cycle_type = CycleType::V,
+                           const std::vector<int> &smooth_it_levels = {},
+                           const std::vector<std::vector<std::vector<int>>> *patches =
+                               nullptr);
   GeometricMultigridSolver(MPI_Comm comm, const IoData &iodata,
                            std::unique_ptr<Solver<OperType>> &&coarse_solver,
                            const std::vector<const Operator *> &P,
-                           const std::vector<const Operator *> *G = nullptr)
+                           const std::vector<const Operator *> *G = nullptr,
+                           const std::vector<std::vector<std::vector<int>>> *patches =
+                               nullptr)
     : GeometricMultigridSolver(
           comm, std::move(coarse_solver), P, G, iodata.solver.linear.mg_cycle_it,
           iodata.solver.linear.mg_smooth_it, iodata.solver.linear.mg_smooth_order,
           iodata.solver.linear.mg_smooth_sf_max, iodata.solver.linear.mg_smooth_sf_min,
-          iodata.solver.linear.mg_smooth_cheby_4th)
+          iodata.solver.linear.mg_smooth_cheby_4th, iodata.solver.linear.mg_cycle_type,
+          iodata.solver.linear.mg_smooth_it_levels, patches)
   {
   }
 
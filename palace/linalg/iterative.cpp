@@ -6,7 +6,9 @@
 #include <algorithm>
 #include <cmath>
 #include <limits>
+#include <numeric>
 #include <string>
+#include <Eigen/Dense>
 #include "linalg/orthog.hpp"
 #include "utils/communication.hpp"
 #include "utils/timer.hpp"
@@ -324,6 +326,126 @@ inline void OrthogonalizeIteration(GmresSolverBase::OrthogType type, MPI_Comm co
   }
 }
 
+template <typename MatType>
+inline MatType HarmonicRitzVectors(const MatType &G, const MatType &VW, int k)
+{
+  // Compute the harmonic Ritz vectors for the k harmonic Ritz values of smallest magnitude,
+  // from the generalized eigenvalue problem Gᴴ G p = θ Gᴴ VW p. Since G has full column
+  // rank, we solve the equivalent standard problem (Gᴴ G)⁻¹ Gᴴ VW p = θ⁻¹ p. For
+  // real-valued problems, the real and imaginary parts of complex conjugate eigenvector
+  // pairs are used to keep the basis real.
+  using ScalarType = typename MatType::Scalar;
+  constexpr double tol = 1.0e-12;
+  const MatType GH = G.adjoint();
+  const MatType X = (GH * G).llt().solve(GH * VW);
+  const Eigen::MatrixXcd S = X.template cast<std::complex<double>>();
+  Eigen::ComplexEigenSolver<Eigen::MatrixXcd> eig(S);
+  const auto &lambda = eig.eigenvalues();
+  const auto &Z = eig.eigenvectors();
+  const auto n = S.cols();
+  std::vector<Eigen::Index> perm(n);
+  std::iota(perm.begin(), perm.end(), 0);
+  std::sort(perm.begin(), perm.end(), [&lambda](auto l, auto r)
+            { return std::abs(lambda(l)) > std::abs(lambda(r)); });
+  MatType P(n, std::min(static_cast<Eigen::Index>(k), n));
+  Eigen::Index kn = 0;
+  for (Eigen::Index i = 0; i < n && kn < P.cols(); i++)
+  {
+    if constexpr (std::is_same<ScalarType, double>::value)
+    {
+      const auto l = lambda(perm[i]);
+      if (std::abs(l.imag()) <= tol * std::abs(l))
+      {
+        // Remove the arbitrary complex phase of the eigenvector for a real eigenvalue.
+        Eigen::VectorXcd z = Z.col(perm[i]);
+        Eigen::Index imax;
+        z.cwiseAbs().maxCoeff(&imax);
+        z *= std::conj(z(imax)) / std::abs(z(imax));
+        P.col(kn++) = z.real();
+      }
+      else if (l.imag() > 0.0)
+      {
+        P.col(kn++) = Z.col(perm[i]).real();
+        if (kn < P.cols())
+        {
+          P.col(kn++) = Z.col(perm[i]).imag();
+        }
+      }
+    }
+    else
+    {
+      P.col(kn++) = Z.col(perm[i]);
+    }
+  }
+  P.conservativeResize(n, kn);
+  return P;
+}
+
+template <typename MatType>
+inline std::vector<std::complex<double>> NewtonShifts(const MatType &H, int s)
+{
+  // Compute s shifts for the Newton basis as the Leja ordering of the Ritz values from the
+  // square Hessenberg matrix H, which maximizes the product of distances of each shift to
+  // the previous ones. For real-valued problems, complex conjugate pairs are kept adjacent
+  // with the positive imaginary part first. Ritz values are reused cyclically if s exceeds
+  // their number.
+  using ScalarType = typename MatType::Scalar;
+  constexpr bool real = std::is_same<ScalarType, double>::value;
+  constexpr double tol = 1.0e-12;
+  Eigen::ComplexEigenSolver<Eigen::MatrixXcd> eig(
+      H.template cast<std::complex<double>>(), false);
+  std::vector<std::complex<double>> theta;
+  for (Eigen::Index i = 0; i < H.cols(); i++)
+  {
+    auto l = eig.eigenvalues()(i);
+    if (real && std::abs(l.imag()) <= tol * std::abs(l))
+    {
+      l.imag(0.0);
+    }
+    else if (real && l.imag() < 0.0)
+    {
+      continue;
+    }
+    theta.push_back(l);
+  }
+  std::vector<std::complex<double>> shifts;
+  std::vector<bool> used(theta.size(), false);
+  while (static_cast<int>(shifts.size()) < s && !theta.empty())
+  {
+    int imax = -1;
+    double vmax = -std::numeric_limits<double>::infinity();
+    for (std::size_t i = 0; i < theta.size(); i++)
+    {
+      if (used[i])
+      {
+        continue;
+      }
+      double v = shifts.empty() ? std::abs(theta[i]) : 0.0;
+      for (const auto &shift : shifts)
+      {
+        v += std::log(std::abs(theta[i] - shift) + std::numeric_limits<double>::min());
+      }
+      if (v > vmax)
+      {
+        imax = static_cast<int>(i);
+        vmax = v;
+      }
+    }
+    if (imax < 0)
+    {
+      std::fill(used.begin(), used.end(), false);
+      continue;
+    }
+    used[imax] = true;
+    shifts.push_back(theta[imax]);
+    if (real && theta[imax].imag() != 0.0 && static_cast<int>(shifts.size()) < s)
+    {
+      shifts.push_back(std::conj(theta[imax]));
+    }
+  }
+  return shifts;
+}
+
 }  // namespace
 
 template <typename OperType>
@@ -355,6 +477,7 @@ IterativeSolver<OperType>::IterativeSolver(MPI_Comm comm, int print)
   final_it = 0;
 
   use_timer = false;
+  telemetry = nullptr;
 }
 
 template <typename OperType>
@@ -426,123 +549,1781 @@ void CgSolver<OperType>::Mult(const VecType &b, VecType &x) const
   }
   for (; it < max_it && !converged; it++)
   {
+    this->RecordIteration(it, res);
+    if (print_opts.iterations)
+    {
+      Mpi::Print(comm, "{}{:{}d} KSP residual norm ||r||_B = {:.6e}\n",
+                 std::string(tab_width, ' '), it, int_width, res);
+    }
+    if (!it)
+    {
+      p = z;
+    }
+    else
+    {
+      linalg::AXPBY(ScalarType(1.0), z, beta / beta_prev, p);
+    }
+
+    A->Mult(p, z);
+    denom = linalg::Dot(comm, z, p);
+    CheckDot(denom, "PCG operator is not positive definite: (Ap, p) = ");
+    alpha = beta / denom;
+
+    x.Add(alpha, p);
+    r.Add(-alpha, z);
+
+    beta_prev = beta;
+    if (B)
+    {
+      ApplyB(B, r, z, this->use_timer);
+    }
+    else
+    {
+      z = r;
+    }
+    beta = linalg::Dot(comm, z, r);
+    CheckDot(beta, "PCG preconditioner is not positive definite: (Br, r) = ");
+    res = std::sqrt(std::abs(beta));
+    converged = (res < eps);
+  }
+  this->RecordIteration(it, res);
+  if (print_opts.iterations)
+  {
+    Mpi::Print(comm, "{}{:{}d} KSP residual norm ||r||_B = {:.6e}\n",
+               std::string(tab_width, ' '), it, int_width, res);
+  }
+  if (print_opts.summary || (print_opts.warnings && eps > 0.0 && !converged))
+  {
+    Mpi::Print(comm, "{}PCG solver {} in {:d} iteration{}", std::string(tab_width, ' '),
+               converged ? "converged" : "did NOT converge", it, (it == 1) ? "" : "s");
+    if (it > 0)
+    {
+      Mpi::Print(comm, " (avg. reduction factor: {:.3e})\n",
+                 std::pow(res / initial_res, 1.0 / it));
+    }
+    else
+    {
+      Mpi::Print(comm, "\n");
+    }
+  }
+  final_res = res;
+  final_it = it;
+}
+
+template <typename OperType>
+void DeflatedCgSolver<OperType>::UpdateDeflationOperator() const
+{
+  // Recompute A W and E = Wᴴ A W, with a single global reduction for E.
+  const int k = static_cast<int>(W.size());
+  E.resize(k * k);
+  for (int j = 0; j < k; j++)
+  {
+    A->Mult(W[j], AW[j]);
+    linalg::LocalMDot(AW[j], W.data(), k, E.data() + j * k);
+  }
+  if (k > 0)
+  {
+    Mpi::GlobalSum(k * k, E.data(), comm);
+  }
+}
+
+template <typename OperType>
+void DeflatedCgSolver<OperType>::UpdateDeflationSpace(int n) const
+{
+  // The Lanczos tridiagonal matrix for the (deflated) preconditioned operator is formed
+  // from the CG coefficients, see for example Saad, Iterative Methods for Sparse Linear
+  // Systems (2003), Sec. 6.7.3. The Lanczos vectors are the normalized preconditioned
+  // residuals with alternating sign, which is absorbed into the off-diagonal entries.
+  const int k = static_cast<int>(W.size());
+  const int n_add = std::min({recycle_dim - k, std::max(1, recycle_dim / 4), n});
+  if (n_add <= 0)
+  {
+    return;
+  }
+  Eigen::MatrixXd T = Eigen::MatrixXd::Zero(n, n);
+  for (int j = 0; j < n; j++)
+  {
+    T(j, j) = 1.0 / L_alpha[j] + ((j > 0) ? L_beta[j - 1] / L_alpha[j - 1] : 0.0);
+    if (j + 1 < n)
+    {
+      T(j, j + 1) = T(j + 1, j) = -std::sqrt(L_beta[j]) / L_alpha[j];
+    }
+  }
+  Eigen::SelfAdjointEigenSolver<Eigen::MatrixXd> eig(T);
+
+  // The new Ritz vectors for the smallest Ritz values are A-orthogonal to the existing
+  // deflation subspace, since the Lanczos vectors are.
+  const int kn = k + n_add;
+  W.resize(kn);
+  AW.resize(kn);
+  std::vector<ScalarType> s(n);
+  for (int i = k; i < kn; i++)
+  {
+    const auto &S = eig.eigenvectors().col(i - k);
+    std::copy(S.data(), S.data() + n, s.begin());
+    W[i].SetSize(A->Height());
+    W[i].UseDevice(true);
+    W[i] = 0.0;
+    linalg::MAXPY(n, s.data(), L.data(), W[i]);
+    AW[i].SetSize(A->Height());
+    AW[i].UseDevice(true);
+    A->Mult(W[i], AW[i]);
+  }
+
+  // Update E = Wᴴ A W, computing only the new columns (contiguous in memory) and filling
+  // the remaining block by symmetry.
+  std::vector<ScalarType> En(kn * kn);
+  for (int j = 0; j < k; j++)
+  {
+    std::copy(E.data() + j * k, E.data() + (j + 1) * k, En.data() + j * kn);
+  }
+  for (int j = k; j < kn; j++)
+  {
+    linalg::LocalMDot(AW[j], W.data(), kn, En.data() + j * kn);
+  }
+  Mpi::GlobalSum(n_add * kn, En.data() + k * kn, comm);
+  for (int j = 0; j < k; j++)
+  {
+    for (int i = k; i < kn; i++)
+    {
+      if constexpr (std::is_same<ScalarType, RealType>::value)
+      {
+        En[j * kn + i] = En[i * kn + j];
+      }
+      else
+      {
+        En[j * kn + i] = std::conj(En[i * kn + j]);
+      }
+    }
+  }
+  E = std::move(En);
+}
+
+template <typename OperType>
+void DeflatedCgSolver<OperType>::Mult(const VecType &b, VecType &x) const
+{
+  // Set up workspace.
+  using MatType = Eigen::Matrix<ScalarType, Eigen::Dynamic, Eigen::Dynamic>;
+  using VecTypeE = Eigen::Matrix<ScalarType, Eigen::Dynamic, 1>;
+  ScalarType beta, beta_prev = 0.0, alpha, denom;
+  RealType res, eps;
+  MFEM_VERIFY(A, "Operator must be set for DeflatedCgSolver::Mult!");
+  MFEM_ASSERT(A->Width() == x.Size() && A->Height() == b.Size(),
+              "Size mismatch for DeflatedCgSolver::Mult!");
+  MFEM_VERIFY(recycle_dim > 0, "Deflated CG subspace dimension must be positive!");
+  r.SetSize(A->Height());
+  z.SetSize(A->Height());
+  p.SetSize(A->Height());
+  r.UseDevice(true);
+  z.UseDevice(true);
+  p.UseDevice(true);
+  if (update_AW)
+  {
+    UpdateDeflationOperator();
+    update_AW = false;
+  }
+
+  // Factorize the Galerkin matrix for the deflation subspace, discarding the subspace if it
+  // has become numerically rank deficient.
+  Eigen::LLT<MatType> E_llt;
+  if (!W.empty())
+  {
+    const auto k = static_cast<Eigen::Index>(W.size());
+    E_llt.compute(Eigen::Map<const MatType>(E.data(), k, k));
+    if (E_llt.info() != Eigen::Success)
+    {
+      W.clear();
+      AW.clear();
+      E.clear();
+    }
+  }
+  const int k = static_cast<int>(W.size());
+  std::vector<ScalarType> mu(k);
+  auto Project = [&](const VecType &v, const std::vector<VecType> &S)
+  {
+    // Compute mu = E⁻¹ Sᴴ v.
+    linalg::MDot(comm, v, S.data(), k, mu.data());
+    Eigen::Map<VecTypeE> m(mu.data(), k);
+    m = E_llt.solve(VecTypeE(m));
+  };
+
+  // Initialize.
+  if (this->initial_guess)
+  {
+    A->Mult(x, r);
+    linalg::AXPBY(1.0, b, -1.0, r);
+  }
+  else
+  {
+    r = b;
+    x = 0.0;
+  }
+  if (this->initial_guess || k > 0)
+  {
+    ScalarType beta_rhs;
+    if (B)
+    {
+      ApplyB(B, b, p, this->use_timer);
+      beta_rhs = linalg::Dot(comm, p, b);
+    }
+    else
+    {
+      beta_rhs = linalg::Dot(comm, b, b);
+    }
+    CheckDot(beta_rhs, "PCG preconditioner is not positive definite: (Bb, b) = ");
+    initial_res = std::sqrt(std::abs(beta_rhs));
+  }
+  if (k > 0)
+  {
+    // Deflate the initial residual: x ← x + W E⁻¹ Wᴴ r, r ← r - A W E⁻¹ Wᴴ r.
+    Project(r, W);
+    linalg::MAXPY(k, mu.data(), W.data(), x);
+    linalg::MAXPY(k, mu.data(), AW.data(), r, -1.0);
+  }
+  if (B)
+  {
+    ApplyB(B, r, z, this->use_timer);
+  }
+  else
+  {
+    z = r;
+  }
+  beta = linalg::Dot(comm, z, r);
+  CheckDot(beta, "PCG preconditioner is not positive definite: (Br, r) = ");
+  res = std::sqrt(std::abs(beta));
+  if (!this->initial_guess && k == 0)
+  {
+    initial_res = res;
+  }
+  eps = std::max(rel_tol * initial_res, abs_tol);
+  converged = (res < eps);
+
+  // Lanczos vectors are only stored while the deflation subspace is not yet full.
+  const int m = (k < recycle_dim) ? std::min(4 * recycle_dim, max_it) : 0;
+  if (static_cast<int>(L.size()) < m)
+  {
+    L.resize(m);
+  }
+  L_alpha.clear();
+  L_beta.clear();
+
+  // Begin iterations.
+  int it = 0;
+  if (print_opts.iterations)
+  {
+    Mpi::Print(comm, "{}Residual norms for deflated PCG solve\n",
+               std::string(tab_width + int_width - 1, ' '));
+  }
+  for (; it < max_it && !converged; it++)
+  {
+    this->RecordIteration(it, res);
     if (print_opts.iterations)
     {
       Mpi::Print(comm, "{}{:{}d} KSP residual norm ||r||_B = {:.6e}\n",
                  std::string(tab_width, ' '), it, int_width, res);
     }
+    if (k > 0)
+    {
+      // Keep the search direction A-orthogonal to W: z ← z - W E⁻¹ (A W)ᴴ z.
+      Project(z, AW);
+      linalg::MAXPY(k, mu.data(), W.data(), z, -1.0);
+    }
+    if (it < m)
+    {
+      L[it].SetSize(A->Height());
+      L[it].UseDevice(true);
+      L[it] = z;
+      L[it] *= 1.0 / res;
+    }
     if (!it)
     {
       p = z;
     }
     else
     {
-      linalg::AXPBY(ScalarType(1.0), z, beta / beta_prev, p);
+      linalg::AXPBY(ScalarType(1.0), z, beta / beta_prev, p);
+    }
+
+    A->Mult(p, z);
+    denom = linalg::Dot(comm, z, p);
+    CheckDot(denom, "PCG operator is not positive definite: (Ap, p) = ");
+    alpha = beta / denom;
+
+    x.Add(alpha, p);
+    r.Add(-alpha, z);
+
+    beta_prev = beta;
+    if (B)
+    {
+      ApplyB(B, r, z, this->use_timer);
+    }
+    else
+    {
+      z = r;
+    }
+    beta = linalg::Dot(comm, z, r);
+    CheckDot(beta, "PCG preconditioner is not positive definite: (Br, r) = ");
+    res = std::sqrt(std::abs(beta));
+    converged = (res < eps);
+    if (it < m)
+    {
+      L_alpha.push_back(std::real(alpha));
+      L_beta.push_back(std::real(beta / beta_prev));
+    }
+  }
+  this->RecordIteration(it, res);
+  if (print_opts.iterations)
+  {
+    Mpi::Print(comm, "{}{:{}d} KSP residual norm ||r||_B = {:.6e}\n",
+               std::string(tab_width, ' '), it, int_width, res);
+  }
+  if (print_opts.summary || (print_opts.warnings && eps > 0.0 && !converged))
+  {
+    Mpi::Print(comm, "{}Deflated PCG solver {} in {:d} iteration{}",
+               std::string(tab_width, ' '), converged ? "converged" : "did NOT converge",
+               it, (it == 1) ? "" : "s");
+    if (it > 0)
+    {
+      Mpi::Print(comm, " (avg. reduction factor: {:.3e})\n",
+                 std::pow(res / initial_res, 1.0 / it));
+    }
+    else
+    {
+      Mpi::Print(comm, "\n");
+    }
+  }
+  final_res = res;
+  final_it = it;
+
+  // Extend the deflation subspace for the next call to Mult. Once it is full, the Lanczos
+  // vectors are no longer needed.
+  UpdateDeflationSpace(static_cast<int>(L_alpha.size()));
+  if (static_cast<int>(W.size()) >= recycle_dim)
+  {
+    L.clear();
+    L.shrink_to_fit();
+  }
+}
+
+template <typename OperType>
+void MinResSolver<OperType>::Mult(const VecType &b, VecType &x) const
+{
+  // Set up workspace.
+  ScalarType alpha, eta, g, e, d, a, bn;
+  RealType beta, beta_next, res, eps;
+  RealType cs[2] = {1.0, 1.0};
+  ScalarType sn[2] = {0.0, 0.0};
+  MFEM_VERIFY(A, "Operator must be set for MinResSolver::Mult!");
+  MFEM_ASSERT(A->Width() == x.Size() && A->Height() == b.Size(),
+              "Size mismatch for MinResSolver::Mult!");
+  for (int i = 0; i < 3; i++)
+  {
+    u[i].SetSize(A->Height());
+    w[i].SetSize(A->Height());
+    u[i].UseDevice(true);
+    w[i].UseDevice(true);
+  }
+  z.SetSize(A->Height());
+  z.UseDevice(true);
+
+  // The preconditioned Lanczos vectors are stored complex conjugated, so that the Lanczos
+  // process for complex symmetric operators, A conj(Vₖ) = Vₖ₊₁ Tₖ, only requires indefinite
+  // inner products. For real-valued systems this is the usual preconditioned MINRES.
+  auto ApplyBConj = [this](const VecType &r, VecType &y)
+  {
+    if (B)
+    {
+      ApplyB(B, r, y, this->use_timer);
+    }
+    else
+    {
+      y = r;
+    }
+    if constexpr (std::is_same<OperType, ComplexOperator>::value)
+    {
+      y.Conj();
+    }
+  };
+
+  // Initialize.
+  if (this->initial_guess)
+  {
+    A->Mult(x, u[0]);
+    linalg::AXPBY(1.0, b, -1.0, u[0]);
+  }
+  else
+  {
+    u[0] = b;
+    x = 0.0;
+  }
+  ApplyBConj(u[0], z);
+  {
+    const auto dot = linalg::TransposeDot(comm, u[0], z);
+    CheckDot(dot, "MINRES preconditioner is not positive definite: (Br, r) = ");
+    beta = std::sqrt(std::abs(dot));
+  }
+  res = beta;
+  if (this->initial_guess)
+  {
+    ScalarType beta_rhs;
+    if (B)
+    {
+      ApplyB(B, b, w[0], this->use_timer);
+      beta_rhs = linalg::Dot(comm, w[0], b);
+    }
+    else
+    {
+      beta_rhs = linalg::Dot(comm, b, b);
+    }
+    CheckDot(beta_rhs, "MINRES preconditioner is not positive definite: (Bb, b) = ");
+    initial_res = std::sqrt(std::abs(beta_rhs));
+  }
+  else
+  {
+    initial_res = res;
+  }
+  eps = std::max(rel_tol * initial_res, abs_tol);
+  converged = (res < eps);
+  if (beta > 0.0)
+  {
+    u[0] *= 1.0 / beta;
+    z *= 1.0 / beta;
+  }
+  u[2] = 0.0;
+  w[1] = 0.0;
+  w[2] = 0.0;
+  eta = beta;
+
+  // Begin iterations.
+  int it = 0;
+  if (print_opts.iterations)
+  {
+    Mpi::Print(comm, "{}Residual norms for MINRES solve\n",
+               std::string(tab_width + int_width - 1, ' '));
+  }
+  for (; it < max_it && !converged; it++)
+  {
+    this->RecordIteration(it, res);
+    if (print_opts.iterations)
+    {
+      Mpi::Print(comm, "{}{:{}d} KSP residual norm ||r||_B = {:.6e}\n",
+                 std::string(tab_width, ' '), it, int_width, res);
+    }
+    const VecType &uj = u[it % 3], &uj_prev = u[(it + 2) % 3];
+    VecType &q = u[(it + 1) % 3], &wj = w[it % 3];
+
+    // Lanczos step: q = A conj(zⱼ) - αⱼ uⱼ - βⱼ uⱼ₋₁ with αⱼ = zⱼᴴ A conj(zⱼ), where z
+    // holds conj(zⱼ).
+    A->Mult(z, q);
+    alpha = linalg::TransposeDot(comm, q, z);
+    q.Add(-alpha, uj);
+    q.Add(-beta, uj_prev);
+
+    // Apply the previous two rotations to the new column of the tridiagonal matrix and
+    // update the search direction wⱼ = (conj(zⱼ) - d wⱼ₋₁ - e wⱼ₋₂) / ρ (scaled below).
+    e = 0.0;
+    d = beta;
+    a = alpha;
+    ApplyPlaneRotation(e, d, cs[1], sn[1]);
+    ApplyPlaneRotation(d, a, cs[0], sn[0]);
+    wj = z;
+    linalg::AXPBYPCZ(-d, w[(it + 2) % 3], -e, w[(it + 1) % 3], ScalarType(1.0), wj);
+
+    // Compute the next preconditioned Lanczos vector and its norm.
+    ApplyBConj(q, z);
+    {
+      const auto dot = linalg::TransposeDot(comm, q, z);
+      CheckDot(dot, "MINRES preconditioner is not positive definite: (Br, r) = ");
+      beta_next = std::sqrt(std::abs(dot));
+    }
+
+    // Eliminate the subdiagonal entry with a new rotation and update the solution and
+    // residual norm estimate.
+    bn = beta_next;
+    cs[1] = cs[0];
+    sn[1] = sn[0];
+    GeneratePlaneRotation(a, bn, cs[0], sn[0]);
+    ApplyPlaneRotation(a, bn, cs[0], sn[0]);
+    g = eta;
+    eta = 0.0;
+    ApplyPlaneRotation(g, eta, cs[0], sn[0]);
+    wj *= 1.0 / a;
+    x.Add(g, wj);
+    res = std::abs(eta);
+    converged = (res < eps);
+
+    // Normalize the Lanczos vectors (a zero norm indicates an invariant subspace has been
+    // found and the solution is exact).
+    beta = beta_next;
+    if (beta > 0.0)
+    {
+      q *= 1.0 / beta;
+      z *= 1.0 / beta;
+    }
+    else
+    {
+      converged = true;
+      it++;
+      break;
+    }
+  }
+  this->RecordIteration(it, res);
+  if (print_opts.iterations)
+  {
+    Mpi::Print(comm, "{}{:{}d} KSP residual norm ||r||_B = {:.6e}\n",
+               std::string(tab_width, ' '), it, int_width, res);
+  }
+  if (print_opts.summary || (print_opts.warnings && eps > 0.0 && !converged))
+  {
+    Mpi::Print(comm, "{}MINRES solver {} in {:d} iteration{}", std::string(tab_width, ' '),
+               converged ? "converged" : "did NOT converge", it, (it == 1) ? "" : "s");
+    if (it > 0)
+    {
+      Mpi::Print(comm, " (avg. reduction factor: {:.3e})\n",
+                 std::pow(res / initial_res, 1.0 / it));
+    }
+    else
+    {
+      Mpi::Print(comm, "\n");
+    }
+  }
+  final_res = res;
+  final_it = it;
+}
+
+template <typename OperType>
+void BiCGStabSolver<OperType>::Mult(const VecType &b, VecType &x) const
+{
+  // Set up workspace.
+  ScalarType rho, rho_prev = 1.0, alpha = 1.0, omega = 1.0, denom;
+  RealType res, eps;
+  MFEM_VERIFY(A, "Operator must be set for BiCGStabSolver::Mult!");
+  MFEM_ASSERT(A->Width() == x.Size() && A->Height() == b.Size(),
+              "Size mismatch for BiCGStabSolver::Mult!");
+  r.SetSize(A->Height());
+  rh.SetSize(A->Height());
+  p.SetSize(A->Height());
+  v.SetSize(A->Height());
+  t.SetSize(A->Height());
+  z.SetSize(A->Height());
+  r.UseDevice(true);
+  rh.UseDevice(true);
+  p.UseDevice(true);
+  v.UseDevice(true);
+  t.UseDevice(true);
+  z.UseDevice(true);
+
+  // Initialize. The residual norm for convergence is the unpreconditioned one, since right
+  // preconditioning is used.
+  if (this->initial_guess)
+  {
+    A->Mult(x, r);
+    linalg::AXPBY(1.0, b, -1.0, r);
+  }
+  else
+  {
+    r = b;
+    x = 0.0;
+  }
+  rh = r;
+  if constexpr (std::is_same<OperType, ComplexOperator>::value)
+  {
+    rh.Conj();
+  }
+  res = linalg::Norml2(comm, r);
+  initial_res = this->initial_guess ? linalg::Norml2(comm, b) : res;
+  eps = std::max(rel_tol * initial_res, abs_tol);
+  converged = (res < eps);
+
+  // Begin iterations.
+  int it = 0;
+  if (print_opts.iterations)
+  {
+    Mpi::Print(comm, "{}Residual norms for BiCGSTAB solve\n",
+               std::string(tab_width + int_width - 1, ' '));
+  }
+  for (; it < max_it && !converged; it++)
+  {
+    this->RecordIteration(it, res);
+    if (print_opts.iterations)
+    {
+      Mpi::Print(comm, "{}{:{}d} KSP residual norm ||r|| = {:.6e}\n",
+                 std::string(tab_width, ' '), it, int_width, res);
+    }
+    rho = linalg::Dot(comm, r, rh);
+    if (rho == ScalarType(0.0))
+    {
+      if (print_opts.warnings)
+      {
+        Mpi::Print(comm, "{}BiCGSTAB solver breakdown: (r, r̂) = 0\n",
+                   std::string(tab_width, ' '));
+      }
+      break;
+    }
+    if (!it)
+    {
+      p = r;
+    }
+    else
+    {
+      // p = r + β (p - ω v).
+      const ScalarType beta = (rho / rho_prev) * (alpha / omega);
+      linalg::AXPBYPCZ(ScalarType(1.0), r, -beta * omega, v, beta, p);
+    }
+
+    // First half step: s = r - α A B p (stored in r).
+    if (B)
+    {
+      ApplyB(B, p, z, this->use_timer);
+    }
+    else
+    {
+      z = p;
+    }
+    A->Mult(z, v);
+    denom = linalg::Dot(comm, v, rh);
+    alpha = rho / denom;
+    x.Add(alpha, z);
+    r.Add(-alpha, v);
+    res = linalg::Norml2(comm, r);
+    converged = (res < eps);
+    if (converged)
+    {
+      it++;
+      break;
+    }
+
+    // Second half step: r = s - ω A B s, with ω minimizing the residual norm.
+    if (B)
+    {
+      ApplyB(B, r, z, this->use_timer);
+    }
+    else
+    {
+      z = r;
+    }
+    A->Mult(z, t);
+    denom = linalg::Dot(comm, t, t);
+    omega = (std::abs(denom) > 0.0) ? linalg::Dot(comm, r, t) / denom : ScalarType(0.0);
+    x.Add(omega, z);
+    r.Add(-omega, t);
+    res = linalg::Norml2(comm, r);
+    converged = (res < eps);
+    rho_prev = rho;
+    if (omega == ScalarType(0.0))
+    {
+      if (print_opts.warnings)
+      {
+        Mpi::Print(comm, "{}BiCGSTAB solver breakdown: ω = 0\n",
+                   std::string(tab_width, ' '));
+      }
+      it++;
+      break;
+    }
+  }
+  this->RecordIteration(it, res);
+  if (print_opts.iterations)
+  {
+    Mpi::Print(comm, "{}{:{}d} KSP residual norm ||r|| = {:.6e}\n",
+               std::string(tab_width, ' '), it, int_width, res);
+  }
+  if (print_opts.summary || (print_opts.warnings && eps > 0.0 && !converged))
+  {
+    Mpi::Print(comm, "{}BiCGSTAB solver {} in {:d} iteration{}",
+               std::string(tab_width, ' '), converged ? "converged" : "did NOT converge",
+               it, (it == 1) ? "" : "s");
+    if (it > 0)
+    {
+      Mpi::Print(comm, " (avg. reduction factor: {:.3e})\n",
+                 std::pow(res / initial_res, 1.0 / it));
+    }
+    else
+    {
+      Mpi::Print(comm, "\n");
+    }
+  }
+  final_res = res;
+  final_it = it;
+}
+
+template <typename OperType>
+void CocgSolver<OperType>::Mult(const VecType &b, VecType &x) const
+{
+  // Set up workspace.
+  ScalarType rho, rho_prev = 1.0, alpha, denom, dot[2];
+  RealType res, eps;
+  MFEM_VERIFY(A, "Operator must be set for CocgSolver::Mult!");
+  MFEM_ASSERT(A->Width() == x.Size() && A->Height() == b.Size(),
+              "Size mismatch for CocgSolver::Mult!");
+  r.SetSize(A->Height());
+  z.SetSize(A->Height());
+  p.SetSize(A->Height());
+  r.UseDevice(true);
+  z.UseDevice(true);
+  p.UseDevice(true);
+
+  // Initialize. The indefinite inner product (z, r) = rᵀ B r and the residual norm are
+  // computed with a single reduction.
+  if (this->initial_guess)
+  {
+    A->Mult(x, r);
+    linalg::AXPBY(1.0, b, -1.0, r);
+  }
+  else
+  {
+    r = b;
+    x = 0.0;
+  }
+  if (B)
+  {
+    ApplyB(B, r, z, this->use_timer);
+  }
+  else
+  {
+    z = r;
+  }
+  dot[0] = linalg::LocalTransposeDot(z, r);
+  dot[1] = linalg::LocalDot(r, r);
+  Mpi::GlobalSum(2, dot, comm);
+  rho = dot[0];
+  res = std::sqrt(std::abs(dot[1]));
+  initial_res = this->initial_guess ? linalg::Norml2(comm, b) : res;
+  eps = std::max(rel_tol * initial_res, abs_tol);
+  converged = (res < eps);
+
+  // Begin iterations.
+  int it = 0;
+  if (print_opts.iterations)
+  {
+    Mpi::Print(comm, "{}Residual norms for COCG solve\n",
+               std::string(tab_width + int_width - 1, ' '));
+  }
+  for (; it < max_it && !converged; it++)
+  {
+    this->RecordIteration(it, res);
+    if (print_opts.iterations)
+    {
+      Mpi::Print(comm, "{}{:{}d} KSP residual norm ||r|| = {:.6e}\n",
+                 std::string(tab_width, ' '), it, int_width, res);
+    }
+    if (!it)
+    {
+      p = z;
+    }
+    else
+    {
+      linalg::AXPBY(ScalarType(1.0), z, rho / rho_prev, p);
+    }
+
+    A->Mult(p, z);
+    denom = linalg::TransposeDot(comm, z, p);
+    if (rho == ScalarType(0.0) || denom == ScalarType(0.0))
+    {
+      if (print_opts.warnings)
+      {
+        Mpi::Print(comm, "{}COCG solver breakdown: (r, Br) = {:.3e}, (p, Ap) = {:.3e}\n",
+                   std::string(tab_width, ' '), std::abs(rho), std::abs(denom));
+      }
+      break;
+    }
+    alpha = rho / denom;
+
+    x.Add(alpha, p);
+    r.Add(-alpha, z);
+
+    rho_prev = rho;
+    if (B)
+    {
+      ApplyB(B, r, z, this->use_timer);
+    }
+    else
+    {
+      z = r;
+    }
+    dot[0] = linalg::LocalTransposeDot(z, r);
+    dot[1] = linalg::LocalDot(r, r);
+    Mpi::GlobalSum(2, dot, comm);
+    rho = dot[0];
+    res = std::sqrt(std::abs(dot[1]));
+    converged = (res < eps);
+  }
+  this->RecordIteration(it, res);
+  if (print_opts.iterations)
+  {
+    Mpi::Print(comm, "{}{:{}d} KSP residual norm ||r|| = {:.6e}\n",
+               std::string(tab_width, ' '), it, int_width, res);
+  }
+  if (print_opts.summary || (print_opts.warnings && eps > 0.0 && !converged))
+  {
+    Mpi::Print(comm, "{}COCG solver {} in {:d} iteration{}", std::string(tab_width, ' '),
+               converged ? "converged" : "did NOT converge", it, (it == 1) ? "" : "s");
+    if (it > 0)
+    {
+      Mpi::Print(comm, " (avg. reduction factor: {:.3e})\n",
+                 std::pow(res / initial_res, 1.0 / it));
+    }
+    else
+    {
+      Mpi::Print(comm, "\n");
+    }
+  }
+  final_res = res;
+  final_it = it;
+}
+
+template <typename OperType>
+void CocrSolver<OperType>::Mult(const VecType &b, VecType &x) const
+{
+  // Set up workspace.
+  ScalarType rho, rho_prev = 1.0, alpha, denom, dot[2];
+  RealType res, eps;
+  MFEM_VERIFY(A, "Operator must be set for CocrSolver::Mult!");
+  MFEM_ASSERT(A->Width() == x.Size() && A->Height() == b.Size(),
+              "Size mismatch for CocrSolver::Mult!");
+  r.SetSize(A->Height());
+  u.SetSize(A->Height());
+  p.SetSize(A->Height());
+  q.SetSize(A->Height());
+  w.SetSize(A->Height());
+  z.SetSize(A->Height());
+  r.UseDevice(true);
+  u.UseDevice(true);
+  p.UseDevice(true);
+  q.UseDevice(true);
+  w.UseDevice(true);
+  z.UseDevice(true);
+
+  // Initialize. The preconditioned residual u = B r and w = A u, as well as q = A p, are
+  // updated by recurrences so that each iteration requires only a single operator
+  // application.
+  if (this->initial_guess)
+  {
+    A->Mult(x, r);
+    linalg::AXPBY(1.0, b, -1.0, r);
+  }
+  else
+  {
+    r = b;
+    x = 0.0;
+  }
+  if (B)
+  {
+    ApplyB(B, r, u, this->use_timer);
+  }
+  else
+  {
+    u = r;
+  }
+  A->Mult(u, w);
+  dot[0] = linalg::LocalTransposeDot(w, u);
+  dot[1] = linalg::LocalDot(r, r);
+  Mpi::GlobalSum(2, dot, comm);
+  rho = dot[0];
+  res = std::sqrt(std::abs(dot[1]));
+  initial_res = this->initial_guess ? linalg::Norml2(comm, b) : res;
+  eps = std::max(rel_tol * initial_res, abs_tol);
+  converged = (res < eps);
+
+  // Begin iterations.
+  int it = 0;
+  if (print_opts.iterations)
+  {
+    Mpi::Print(comm, "{}Residual norms for COCR solve\n",
+               std::string(tab_width + int_width - 1, ' '));
+  }
+  for (; it < max_it && !converged; it++)
+  {
+    this->RecordIteration(it, res);
+    if (print_opts.iterations)
+    {
+      Mpi::Print(comm, "{}{:{}d} KSP residual norm ||r|| = {:.6e}\n",
+                 std::string(tab_width, ' '), it, int_width, res);
+    }
+    if (!it)
+    {
+      p = u;
+      q = w;
+    }
+    else
+    {
+      linalg::AXPBY(ScalarType(1.0), u, rho / rho_prev, p);
+      linalg::AXPBY(ScalarType(1.0), w, rho / rho_prev, q);
+    }
+
+    if (B)
+    {
+      ApplyB(B, q, z, this->use_timer);
+    }
+    else
+    {
+      z = q;
+    }
+    denom = linalg::TransposeDot(comm, z, q);
+    if (rho == ScalarType(0.0) || denom == ScalarType(0.0))
+    {
+      if (print_opts.warnings)
+      {
+        Mpi::Print(comm, "{}COCR solver breakdown: (u, Au) = {:.3e}, (Ap, BAp) = {:.3e}\n",
+                   std::string(tab_width, ' '), std::abs(rho), std::abs(denom));
+      }
+      break;
+    }
+    alpha = rho / denom;
+
+    x.Add(alpha, p);
+    r.Add(-alpha, q);
+    u.Add(-alpha, z);
+
+    rho_prev = rho;
+    A->Mult(u, w);
+    dot[0] = linalg::LocalTransposeDot(w, u);
+    dot[1] = linalg::LocalDot(r, r);
+    Mpi::GlobalSum(2, dot, comm);
+    rho = dot[0];
+    res = std::sqrt(std::abs(dot[1]));
+    converged = (res < eps);
+  }
+  this->RecordIteration(it, res);
+  if (print_opts.iterations)
+  {
+    Mpi::Print(comm, "{}{:{}d} KSP residual norm ||r|| = {:.6e}\n",
+               std::string(tab_width, ' '), it, int_width, res);
+  }
+  if (print_opts.summary || (print_opts.warnings && eps > 0.0 && !converged))
+  {
+    Mpi::Print(comm, "{}COCR solver {} in {:d} iteration{}", std::string(tab_width, ' '),
+               converged ? "converged" : "did NOT converge", it, (it == 1) ? "" : "s");
+    if (it > 0)
+    {
+      Mpi::Print(comm, " (avg. reduction factor: {:.3e})\n",
+                 std::pow(res / initial_res, 1.0 / it));
+    }
+    else
+    {
+      Mpi::Print(comm, "\n");
+    }
+  }
+  final_res = res;
+  final_it = it;
+}
+
+template <typename OperType>
+void GmresSolver<OperType>::Initialize() const
+{
+  if (!V.empty())
+  {
+    MFEM_ASSERT(V.size() == static_cast<std::size_t>(max_dim + 1) &&
+                    V[0].Size() == A->Height(),
+                "Repeated solves with GmresSolver should not modify the operator size or "
+                "restart dimension!");
+    return;
+  }
+  if (max_dim < 0)
+  {
+    max_dim = max_it;
+  }
+  constexpr int init_size = 5;
+  V.resize(max_dim + 1);
+  for (int j = 0; j < std::min(init_size, max_dim + 1); j++)
+  {
+    V[j].SetSize(A->Height());
+    V[j].UseDevice(true);
+  }
+  H.resize((max_dim + 1) * max_dim);
+  s.resize(max_dim + 1);
+  cs.resize(max_dim + 1);
+  sn.resize(max_dim + 1);
+}
+
+template <typename OperType>
+void GmresSolver<OperType>::Update(int j) const
+{
+  // Add storage for basis vectors in increments.
+  constexpr int add_size = 10;
+  for (int k = j + 1; k < std::min(j + 1 + add_size, max_dim + 1); k++)
+  {
+    V[k].SetSize(A->Height());
+    V[k].UseDevice(true);
+  }
+}
+
+template <typename OperType>
+void GmresSolver<OperType>::Mult(const VecType &b, VecType &x) const
+{
+  // Set up workspace.
+  RealType beta = 0.0, true_beta, eps = 0.0;
+  MFEM_VERIFY(A, "Operator must be set for GmresSolver::Mult!");
+  MFEM_ASSERT(A->Width() == x.Size() && A->Height() == b.Size(),
+              "Size mismatch for GmresSolver::Mult!");
+  r.SetSize(A->Height());
+  r.UseDevice(true);
+  Initialize();
+
+  // Optionally monitor the linear functionals of the iterate qᵢ = lᵢᵀ x, where x = x₀ + V y
+  // for left preconditioning. The functionals of each new basis vector are computed in the
+  // same global reduction as its norm.
+  const int n_qoi = (qoi_funcs && qoi_tol > 0.0) ? static_cast<int>(qoi_funcs->size()) : 0;
+  const bool use_qoi = (n_qoi > 0 && (!B || pc_side == PrecSide::LEFT));
+  if (n_qoi > 0 && !use_qoi && print_opts.warnings)
+  {
+    Mpi::Print(comm,
+               "{}GMRES quantity of interest stopping criterion is not supported with "
+               "right preconditioning and will be ignored\n",
+               std::string(tab_width, ' '));
+  }
+  if (use_qoi)
+  {
+    qoi_V.resize(n_qoi * (max_dim + 1));
+    qoi_x.resize(n_qoi);
+    qoi_q.resize(n_qoi);
+    qoi_y.resize(max_dim + 1);
+    qoi_dot.resize(1 + 2 * n_qoi);
+    qoi_floor.resize(*std::max_element(qoi_groups.begin(), qoi_groups.end()) + 1);
+  }
+  auto NormAndQoI = [&](const VecType &w, const VecType *y, ScalarType *qw, ScalarType *qy)
+  {
+    const int n = 1 + (y ? 2 : 1) * n_qoi;
+    qoi_dot[0] = linalg::LocalDot(w, w);
+    for (int i = 0; i < n_qoi; i++)
+    {
+      qoi_dot[1 + i] = linalg::LocalTransposeDot(w, (*qoi_funcs)[i]);
+      if (y)
+      {
+        qoi_dot[1 + n_qoi + i] = linalg::LocalTransposeDot(*y, (*qoi_funcs)[i]);
+      }
+    }
+    Mpi::GlobalSum(n, qoi_dot.data(), comm);
+    const RealType nrm = std::sqrt(std::real(qoi_dot[0]));
+    for (int i = 0; i < n_qoi; i++)
+    {
+      qw[i] = qoi_dot[1 + i] / nrm;
+      if (y)
+      {
+        qy[i] = qoi_dot[1 + n_qoi + i];
+      }
+    }
+    return nrm;
+  };
+  bool qoi_init = false, qoi_converged = false;
+  int qoi_count = 0;
+
+  // Begin iterations.
+  converged = false;
+  int it = 0, restart = 0;
+  if (print_opts.iterations)
+  {
+    Mpi::Print(comm, "{}Residual norms for GMRES solve\n",
+               std::string(tab_width + int_width - 1, ' '));
+  }
+  for (; it < max_it; restart++)
+  {
+    // Initialize.
+    InitialResidual(pc_side, A, B, b, x, r, V[0], (this->initial_guess || restart > 0),
+                    this->use_timer);
+    true_beta = use_qoi ? NormAndQoI(r, &x, qoi_V.data(), qoi_x.data())
+                        : linalg::Norml2(comm, r);
+    CheckDot(true_beta, "GMRES residual norm is not valid: beta = ");
+    if (it == 0)
+    {
+      if (this->initial_guess)
+      {
+        RealType beta_rhs;
+        if (B && pc_side == PrecSide::LEFT)
+        {
+          ApplyB(B, b, V[0], this->use_timer);
+          beta_rhs = linalg::Norml2(comm, V[0]);
+        }
+        else  // !B || pc_side == PrecSide::RIGHT
+        {
+          beta_rhs = linalg::Norml2(comm, b);
+        }
+        CheckDot(beta_rhs, "GMRES residual norm is not valid: beta_rhs = ");
+        initial_res = beta_rhs;
+      }
+      else
+      {
+        initial_res = true_beta;
+      }
+      eps = std::max(rel_tol * initial_res, abs_tol);
+    }
+    else if (beta > 0.0 && std::abs(beta - true_beta) > 0.1 * true_beta &&
+             print_opts.warnings)
+    {
+      Mpi::Print(
+          comm,
+          "{}GMRES residual at restart ({:.6e}) is far from the residual norm estimate "
+          "from the recursion formula ({:.6e}) (initial residual = {:.6e})\n",
+          std::string(tab_width, ' '), true_beta, beta, initial_res);
+    }
+    beta = true_beta;
+    if (beta < eps)
+    {
+      converged = true;
+      break;
+    }
+
+    V[0] = 0.0;
+    V[0].Add(1.0 / beta, r);
+    std::fill(s.begin(), s.end(), 0.0);
+    s[0] = beta;
+
+    int j = 0;
+    for (;; j++, it++)
+    {
+      this->RecordIteration(it, beta);
+      if (print_opts.iterations)
+      {
+        Mpi::Print(comm, "{}{:{}d} (restart {:d}) KSP residual norm {:.6e}\n",
+                   std::string(tab_width, ' '), it, int_width, restart, beta);
+      }
+      VecType &w = V[j + 1];
+      if (w.Size() == 0)
+      {
+        Update(j);
+      }
+      ApplyBA(pc_side, A, B, V[j], w, r, this->use_timer);
+
+      ScalarType *Hj = H.data() + j * (max_dim + 1);
+      OrthogonalizeIteration(orthog_type, comm, V, w, Hj, j);
+      Hj[j + 1] = use_qoi ? NormAndQoI(w, nullptr, qoi_V.data() + (j + 1) * n_qoi, nullptr)
+                          : linalg::Norml2(comm, w);
+      w *= 1.0 / Hj[j + 1];
+
+      for (int k = 0; k < j; k++)
+      {
+        ApplyPlaneRotation(Hj[k], Hj[k + 1], cs[k], sn[k]);
+      }
+      GeneratePlaneRotation(Hj[j], Hj[j + 1], cs[j], sn[j]);
+      ApplyPlaneRotation(Hj[j], Hj[j + 1], cs[j], sn[j]);
+      ApplyPlaneRotation(s[j], s[j + 1], cs[j], sn[j]);
+
+      beta = std::abs(s[j + 1]);
+      CheckDot(beta, "GMRES residual norm is not valid: beta = ");
+      converged = (beta < eps);
+      if (use_qoi && !converged)
+      {
+        // Solve the triangular least squares system for the current iterate and evaluate
+        // the functionals. Each quantity is tested against its own magnitude (after
+        // subtracting its offset, such as the incident part of an S-parameter), with a floor
+        // relative to the scale of its group so that quantities which are negligible
+        // compared to the others in the group (or to the nominal group magnitude) are
+        // tested in an absolute sense. Converged once the change in every quantity is below
+        // the tolerance for two consecutive iterations, and the residual has been reduced
+        // by at least the same factor to avoid stopping early on a stagnating iteration.
+        for (int i = j; i >= 0; i--)
+        {
+          qoi_y[i] = s[i];
+          for (int k = i + 1; k <= j; k++)
+          {
+            qoi_y[i] -= H[k * (max_dim + 1) + i] * qoi_y[k];
+          }
+          qoi_y[i] /= H[i * (max_dim + 1) + i];
+        }
+        constexpr RealType rel_floor = 1.0e-3;
+        for (std::size_t g = 0; g < qoi_floor.size(); g++)
+        {
+          qoi_floor[g] = (g < qoi_scales.size()) ? qoi_scales[g] : 0.0;
+        }
+        for (int i = 0; i < n_qoi; i++)
+        {
+          qoi_dot[i] = qoi_x[i];
+          for (int k = 0; k <= j; k++)
+          {
+            qoi_dot[i] += qoi_V[k * n_qoi + i] * qoi_y[k];
+          }
+          auto &floor_g = qoi_floor[qoi_groups[i]];
+          floor_g = std::max(floor_g, std::abs(qoi_dot[i] - qoi_offsets[i]));
+        }
+        bool qoi_small = qoi_init;
+        for (int i = 0; i < n_qoi; i++)
+        {
+          const RealType scale = std::max(std::abs(qoi_dot[i] - qoi_offsets[i]),
+                                          rel_floor * qoi_floor[qoi_groups[i]]);
+          qoi_small = qoi_small && scale > 0.0 &&
+                      std::abs(qoi_dot[i] - qoi_q[i]) <= qoi_tol * scale;
+          qoi_q[i] = qoi_dot[i];
+        }
+        qoi_count = qoi_small ? qoi_count + 1 : 0;
+        qoi_init = true;
+        converged = qoi_converged = (qoi_count >= 2 && beta <= qoi_tol * initial_res);
+      }
+      if (converged || j + 1 == max_dim || it + 1 == max_it)
+      {
+        it++;
+        break;
+      }
+    }
+
+    // Reconstruct the solution (for restart or due to convergence or maximum iterations).
+    for (int i = j; i >= 0; i--)
+    {
+      ScalarType *Hi = H.data() + i * (max_dim + 1);
+      s[i] /= Hi[i];
+      for (int k = i - 1; k >= 0; k--)
+      {
+        s[k] -= Hi[k] * s[i];
+      }
+    }
+    if (!B || pc_side == PrecSide::LEFT)
+    {
+      linalg::MAXPY(j + 1, s.data(), V.data(), x);
+    }
+    else  // B && pc_side == PrecSide::RIGHT
+    {
+      r = 0.0;
+      linalg::MAXPY(j + 1, s.data(), V.data(), r);
+      ApplyB(B, r, V[0], this->use_timer);
+      x += V[0];
+    }
+    if (converged)
+    {
+      break;
+    }
+  }
+  this->RecordIteration(it, beta);
+  if (print_opts.iterations)
+  {
+    Mpi::Print(comm, "{}{:{}d} (restart {:d}) KSP residual norm {:.6e}\n",
+               std::string(tab_width, ' '), it, int_width, restart, beta);
+  }
+  if (print_opts.summary || (print_opts.warnings && eps > 0.0 && !converged))
+  {
+    Mpi::Print(comm, "{}GMRES solver {} in {:d} iteration{}", std::string(tab_width, ' '),
+               qoi_converged ? "converged (quantities of interest)"
+                             : (converged ? "converged" : "did NOT converge"),
+               it, (it == 1) ? "" : "s");
+    if (it > 0)
+    {
+      Mpi::Print(comm, " (avg. reduction factor: {:.3e})\n",
+                 std::pow(beta / initial_res, 1.0 / it));
+    }
+    else
+    {
+      Mpi::Print(comm, "\n");
+    }
+  }
+  final_res = beta;
+  final_it = it;
+}
+
+template <typename OperType>
+void FgmresSolver<OperType>::Initialize() const
+{
+  GmresSolver<OperType>::Initialize();
+  constexpr int init_size = 5;
+  Z.resize(max_dim + 1);
+  for (int j = 0; j < std::min(init_size, max_dim + 1); j++)
+  {
+    Z[j].SetSize(A->Height());
+    Z[j].UseDevice(true);
+  }
+}
+
+template <typename OperType>
+void FgmresSolver<OperType>::Update(int j) const
+{
+  // Add storage for basis vectors in increments.
+  GmresSolver<OperType>::Update(j);
+  constexpr int add_size = 10;
+  for (int k = j + 1; k < std::min(j + 1 + add_size, max_dim + 1); k++)
+  {
+    Z[k].SetSize(A->Height());
+    Z[k].UseDevice(true);
+  }
+}
+
+template <typename OperType>
+void FgmresSolver<OperType>::Mult(const VecType &b, VecType &x) const
+{
+  // Set up workspace.
+  RealType beta = 0.0, true_beta, eps = 0.0;
+  MFEM_VERIFY(A && B, "Operator and preconditioner must be set for FgmresSolver::Mult!");
+  MFEM_ASSERT(A->Width() == x.Size() && A->Height() == b.Size(),
+              "Size mismatch for FgmresSolver::Mult!");
+  Initialize();
+
+  // Begin iterations.
+  converged = false;
+  int it = 0, restart = 0;
+  if (print_opts.iterations)
+  {
+    Mpi::Print(comm, "{}Residual norms for FGMRES solve\n",
+               std::string(tab_width + int_width - 1, ' '));
+  }
+  for (; it < max_it; restart++)
+  {
+    // Initialize.
+    InitialResidual(PrecSide::RIGHT, A, B, b, x, Z[0], V[0],
+                    (this->initial_guess || restart > 0), this->use_timer);
+    true_beta = linalg::Norml2(comm, Z[0]);
+    CheckDot(true_beta, "FGMRES residual norm is not valid: beta = ");
+    if (it == 0)
+    {
+      if (this->initial_guess)
+      {
+        auto beta_rhs = linalg::Norml2(comm, b);
+        CheckDot(beta_rhs, "GMRES residual norm is not valid: beta_rhs = ");
+        initial_res = beta_rhs;
+      }
+      else
+      {
+        initial_res = true_beta;
+      }
+      eps = std::max(rel_tol * initial_res, abs_tol);
+    }
+    else if (beta > 0.0 && std::abs(beta - true_beta) > 0.1 * true_beta &&
+             print_opts.warnings)
+    {
+      Mpi::Print(
+          comm,
+          "{}FGMRES residual at restart ({:.6e}) is far from the residual norm estimate "
+          "from the recursion formula ({:.6e}) (initial residual = {:.6e})\n",
+          std::string(tab_width, ' '), true_beta, beta, initial_res);
+    }
+    beta = true_beta;
+    if (beta < eps)
+    {
+      converged = true;
+      break;
+    }
+
+    V[0] = 0.0;
+    V[0].Add(1.0 / beta, Z[0]);
+    std::fill(s.begin(), s.end(), 0.0);
+    s[0] = beta;
+
+    int j = 0;
+    for (;; j++, it++)
+    {
+      this->RecordIteration(it, beta);
+      if (print_opts.iterations)
+      {
+        Mpi::Print(comm, "{}{:{}d} (restart {:d}) KSP residual norm {:.6e}\n",
+                   std::string(tab_width, ' '), it, int_width, restart, beta);
+      }
+      VecType &w = V[j + 1];
+      if (w.Size() == 0)
+      {
+        Update(j);
+      }
+      ApplyBA(PrecSide::RIGHT, A, B, V[j], w, Z[j], this->use_timer);
+
+      ScalarType *Hj = H.data() + j * (max_dim + 1);
+      OrthogonalizeIteration(orthog_type, comm, V, w, Hj, j);
+      Hj[j + 1] = linalg::Norml2(comm, w);
+      w *= 1.0 / Hj[j + 1];
+
+      for (int k = 0; k < j; k++)
+      {
+        ApplyPlaneRotation(Hj[k], Hj[k + 1], cs[k], sn[k]);
+      }
+      GeneratePlaneRotation(Hj[j], Hj[j + 1], cs[j], sn[j]);
+      ApplyPlaneRotation(Hj[j], Hj[j + 1], cs[j], sn[j]);
+      ApplyPlaneRotation(s[j], s[j + 1], cs[j], sn[j]);
+
+      beta = std::abs(s[j + 1]);
+      CheckDot(beta, "FGMRES residual norm is not valid: beta = ");
+      converged = (beta < eps);
+      if (converged || j + 1 == max_dim || it + 1 == max_it)
+      {
+        it++;
+        break;
+      }
+    }
+
+    // Reconstruct the solution (for restart or due to convergence or maximum iterations).
+    for (int i = j; i >= 0; i--)
+    {
+      ScalarType *Hi = H.data() + i * (max_dim + 1);
+      s[i] /= Hi[i];
+      for (int k = i - 1; k >= 0; k--)
+      {
+        s[k] -= Hi[k] * s[i];
+      }
+    }
+    linalg::MAXPY(j + 1, s.data(), Z.data(), x);
+    if (converged)
+    {
+      break;
+    }
+  }
+  this->RecordIteration(it, beta);
+  if (print_opts.iterations)
+  {
+    Mpi::Print(comm, "{}{:{}d} (restart {:d}) KSP residual norm {:.6e}\n",
+               std::string(tab_width, ' '), it, int_width, restart, beta);
+  }
+  if (print_opts.summary || (print_opts.warnings && eps > 0.0 && !converged))
+  {
+    Mpi::Print(comm, "{}FGMRES solver {} in {:d} iteration{}", std::string(tab_width, ' '),
+               converged ? "converged" : "did NOT converge", it, (it == 1) ? "" : "s");
+    if (it > 0)
+    {
+      Mpi::Print(comm, " (avg. reduction factor: {:.3e})\n",
+                 std::pow(beta / initial_res, 1.0 / it));
+    }
+    else
+    {
+      Mpi::Print(comm, "\n");
+    }
+  }
+  final_res = beta;
+  final_it = it;
+}
+
+template <typename OperType>
+void PgmresSolver<OperType>::Initialize() const
+{
+  GmresSolver<OperType>::Initialize();
+  z.SetSize(A->Height());
+  w.SetSize(A->Height());
+  z.UseDevice(true);
+  w.UseDevice(true);
+  Hu.resize((max_dim + 1) * max_dim);
+}
+
+template <typename OperType>
+void PgmresSolver<OperType>::Mult(const VecType &b, VecType &x) const
+{
+  // Set up workspace.
+  RealType beta = 0.0, true_beta, eps = 0.0;
+  MFEM_VERIFY(A, "Operator must be set for PgmresSolver::Mult!");
+  MFEM_ASSERT(A->Width() == x.Size() && A->Height() == b.Size(),
+              "Size mismatch for PgmresSolver::Mult!");
+  r.SetSize(A->Height());
+  r.UseDevice(true);
+  Initialize();
+
+  // Relative size of the orthogonal component of a new Krylov vector below which its norm
+  // is recomputed explicitly rather than from the Pythagorean identity.
+  const RealType sqrt_eps = std::sqrt(std::numeric_limits<RealType>::epsilon());
+
+  // Begin iterations.
+  converged = false;
+  int it = 0, restart = 0;
+  if (print_opts.iterations)
+  {
+    Mpi::Print(comm, "{}Residual norms for PGMRES solve\n",
+               std::string(tab_width + int_width - 1, ' '));
+  }
+  for (; it < max_it; restart++)
+  {
+    // Initialize.
+    InitialResidual(pc_side, A, B, b, x, r, V[0], (this->initial_guess || restart > 0),
+                    this->use_timer);
+    true_beta = linalg::Norml2(comm, r);
+    CheckDot(true_beta, "PGMRES residual norm is not valid: beta = ");
+    if (it == 0)
+    {
+      if (this->initial_guess)
+      {
+        RealType beta_rhs;
+        if (B && pc_side == PrecSide::LEFT)
+        {
+          ApplyB(B, b, V[0], this->use_timer);
+          beta_rhs = linalg::Norml2(comm, V[0]);
+        }
+        else  // !B || pc_side == PrecSide::RIGHT
+        {
+          beta_rhs = linalg::Norml2(comm, b);
+        }
+        CheckDot(beta_rhs, "PGMRES residual norm is not valid: beta_rhs = ");
+        initial_res = beta_rhs;
+      }
+      else
+      {
+        initial_res = true_beta;
+      }
+      eps = std::max(rel_tol * initial_res, abs_tol);
+    }
+    else if (beta > 0.0 && std::abs(beta - true_beta) > 0.1 * true_beta &&
+             print_opts.warnings)
+    {
+      Mpi::Print(
+          comm,
+          "{}PGMRES residual at restart ({:.6e}) is far from the residual norm estimate "
+          "from the recursion formula ({:.6e}) (initial residual = {:.6e})\n",
+          std::string(tab_width, ' '), true_beta, beta, initial_res);
+    }
+    beta = true_beta;
+    if (beta < eps)
+    {
+      converged = true;
+      break;
+    }
+
+    V[0] = 0.0;
+    V[0].Add(1.0 / beta, r);
+    std::fill(s.begin(), s.end(), 0.0);
+    s[0] = beta;
+
+    // Prime the pipeline with the first Krylov vector.
+    ApplyBA(pc_side, A, B, V[0], z, r, this->use_timer);
+
+    int j = 0;
+    for (;; j++, it++)
+    {
+      this->RecordIteration(it, beta);
+      if (print_opts.iterations)
+      {
+        Mpi::Print(comm, "{}{:{}d} (restart {:d}) KSP residual norm {:.6e}\n",
+                   std::string(tab_width, ' '), it, int_width, restart, beta);
+      }
+      if (V[j + 1].Size() == 0)
+      {
+        this->Update(j);
+      }
+      const bool last = (j + 1 == max_dim || it + 1 == max_it);
+
+      // Start the reduction for the inner products of z = (BA) v_j with the basis and with
+      // itself, and overlap it with the application of the operator to z.
+      ScalarType *Huj = Hu.data() + j * (max_dim + 1);
+      linalg::LocalMDot(z, V.data(), j + 1, Huj);
+      Huj[j + 1] = linalg::LocalDot(z, z);
+      MPI_Request req = Mpi::GlobalSumBegin(j + 2, Huj, comm);
+      if (!last)
+      {
+        ApplyBA(pc_side, A, B, z, w, r, this->use_timer);
+      }
+      Mpi::Wait(req);
+
+      // Orthogonalize z against the basis to form the next basis vector. The norm follows
+      // from the inner products unless cancellation makes it inaccurate.
+      VecType &v = V[j + 1];
+      v = z;
+      linalg::MAXPY(j + 1, Huj, V.data(), v, -1.0);
+      RealType hnorm = std::real(Huj[j + 1]), hsum = 0.0;
+      for (int k = 0; k <= j; k++)
+      {
+        hsum += std::norm(Huj[k]);
+      }
+      if (hnorm - hsum > sqrt_eps * hnorm)
+      {
+        Huj[j + 1] = std::sqrt(hnorm - hsum);
+      }
+      else
+      {
+        Huj[j + 1] = linalg::Norml2(comm, v);
+      }
+      CheckDot(Huj[j + 1], "PGMRES residual norm is not valid: h = ");
+      v *= 1.0 / Huj[j + 1];
+
+      // Recover the next Krylov vector (BA) v_{j+1} from w = (BA) z without applying the
+      // operator again, using (BA) v_k = Σ_l H(l,k) v_l for the previous basis vectors.
+      if (!last)
+      {
+        std::vector<ScalarType> c(j + 2, 0.0);
+        for (int l = 0; l <= j + 1; l++)
+        {
+          for (int k = std::max(l - 1, 0); k <= j; k++)
+          {
+            c[l] += Hu[k * (max_dim + 1) + l] * Huj[k];
+          }
+        }
+        z = w;
+        linalg::MAXPY(j + 2, c.data(), V.data(), z, -1.0);
+        z *= 1.0 / Huj[j + 1];
+      }
+
+      // Update the least squares problem with the new Hessenberg column.
+      ScalarType *Hj = H.data() + j * (max_dim + 1);
+      std::copy(Huj, Huj + j + 2, Hj);
+      for (int k = 0; k < j; k++)
+      {
+        ApplyPlaneRotation(Hj[k], Hj[k + 1], cs[k], sn[k]);
+      }
+      GeneratePlaneRotation(Hj[j], Hj[j + 1], cs[j], sn[j]);
+      ApplyPlaneRotation(Hj[j], Hj[j + 1], cs[j], sn[j]);
+      ApplyPlaneRotation(s[j], s[j + 1], cs[j], sn[j]);
+
+      beta = std::abs(s[j + 1]);
+      CheckDot(beta, "PGMRES residual norm is not valid: beta = ");
+      converged = (beta < eps);
+      if (converged || last)
+      {
+        it++;
+        break;
+      }
+    }
+
+    // Reconstruct the solution (for restart or due to convergence or maximum iterations).
+    for (int i = j; i >= 0; i--)
+    {
+      ScalarType *Hi = H.data() + i * (max_dim + 1);
+      s[i] /= Hi[i];
+      for (int k = i - 1; k >= 0; k--)
+      {
+        s[k] -= Hi[k] * s[i];
+      }
+    }
+    if (!B || pc_side == PrecSide::LEFT)
+    {
+      linalg::MAXPY(j + 1, s.data(), V.data(), x);
     }
-
-    A->Mult(p, z);
-    denom = linalg::Dot(comm, z, p);
-    CheckDot(denom, "PCG operator is not positive definite: (Ap, p) = ");
-    alpha = beta / denom;
-
-    x.Add(alpha, p);
-    r.Add(-alpha, z);
-
-    beta_prev = beta;
-    if (B)
+    else  // B && pc_side == PrecSide::RIGHT
     {
-      ApplyB(B, r, z, this->use_timer);
+      r = 0.0;
+      linalg::MAXPY(j + 1, s.data(), V.data(), r);
+      ApplyB(B, r, V[0], this->use_timer);
+      x += V[0];
     }
-    else
+    if (converged)
     {
-      z = r;
+      break;
     }
-    beta = linalg::Dot(comm, z, r);
-    CheckDot(beta, "PCG preconditioner is not positive definite: (Br, r) = ");
-    res = std::sqrt(std::abs(beta));
-    converged = (res < eps);
   }
+  this->RecordIteration(it, beta);
   if (print_opts.iterations)
   {
-    Mpi::Print(comm, "{}{:{}d} KSP residual norm ||r||_B = {:.6e}\n",
-               std::string(tab_width, ' '), it, int_width, res);
+    Mpi::Print(comm, "{}{:{}d} (restart {:d}) KSP residual norm {:.6e}\n",
+               std::string(tab_width, ' '), it, int_width, restart, beta);
   }
   if (print_opts.summary || (print_opts.warnings && eps > 0.0 && !converged))
   {
-    Mpi::Print(comm, "{}PCG solver {} in {:d} iteration{}", std::string(tab_width, ' '),
+    Mpi::Print(comm, "{}PGMRES solver {} in {:d} iteration{}", std::string(tab_width, ' '),
                converged ? "converged" : "did NOT converge", it, (it == 1) ? "" : "s");
     if (it > 0)
     {
       Mpi::Print(comm, " (avg. reduction factor: {:.3e})\n",
-                 std::pow(res / initial_res, 1.0 / it));
+                 std::pow(beta / initial_res, 1.0 / it));
     }
     else
     {
       Mpi::Print(comm, "\n");
     }
   }
-  final_res = res;
+  final_res = beta;
   final_it = it;
 }
 
 template <typename OperType>
-void GmresSolver<OperType>::Initialize() const
+void SStepGmresSolver<OperType>::Initialize() const
 {
-  if (!V.empty())
+  GmresSolver<OperType>::Initialize();
+  Hu.resize((max_dim + 1) * max_dim);
+}
+
+template <typename OperType>
+bool SStepGmresSolver<OperType>::BlockArnoldi(int k, int n) const
+{
+  // Matrix powers kernel with the Newton basis V(:, k+i+1) = (M - θᵢ I) V(:, k+i), where
+  // M is the preconditioned operator, such that M V(:, k:k+n-1) = V(:, k:k+n) B̂. For
+  // real-valued problems, a complex conjugate pair of shifts is applied in real arithmetic
+  // as V(:, k+i+1) = (M - Re{θ} I) V(:, k+i) + Im{θ}² V(:, k+i-1).
+  using MatType = Eigen::Matrix<ScalarType, Eigen::Dynamic, Eigen::Dynamic>;
+  MatType Bh = MatType::Zero(n + 1, n);
+  for (int i = 0; i < n; i++)
   {
-    MFEM_ASSERT(V.size() == static_cast<std::size_t>(max_dim + 1) &&
-                    V[0].Size() == A->Height(),
-                "Repeated solves with GmresSolver should not modify the operator size or "
-                "restart dimension!");
-    return;
+    const auto &theta = shifts[i];
+    ApplyBA(pc_side, A, B, V[k + i], V[k + i + 1], r, this->use_timer);
+    Bh(i + 1, i) = 1.0;
+    if constexpr (std::is_same<ScalarType, double>::value)
+    {
+      V[k + i + 1].Add(-theta.real(), V[k + i]);
+      Bh(i, i) = theta.real();
+      if (i > 0 && theta.imag() < 0.0)
+      {
+        const double im2 = theta.imag() * theta.imag();
+        V[k + i + 1].Add(im2, V[k + i - 1]);
+        Bh(i - 1, i) = -im2;
+      }
+    }
+    else
+    {
+      V[k + i + 1].Add(-theta, V[k + i]);
+      Bh(i, i) = theta;
+    }
   }
-  if (max_dim < 0)
+
+  // Block classical Gram-Schmidt with Cholesky QR for W = V(:, k+1:k+n). Each pass fuses
+  // the projection C = V(:, 0:k)ᴴ W and the Gram matrix Wᴴ W into a single reduction, and
+  // computes the Cholesky factor of the Gram matrix of the projected block as
+  // Wᴴ W - Cᴴ C. A second pass restores orthogonality lost for ill-conditioned blocks.
+  const int passes = (orthog_type == OrthogType::CGS) ? 1 : 2;
+  MatType C = MatType::Zero(k + 1, n), R = MatType::Identity(n, n);
+  for (int pass = 0; pass < passes; pass++)
   {
-    max_dim = max_it;
+    MatType X(k + 1 + n, n);
+    for (int j = 0; j < n; j++)
+    {
+      const auto &w = V[k + 1 + j];
+      linalg::LocalMDot(w, V.data(), k + 1, X.col(j).data());
+      linalg::LocalMDot(w, V.data() + k + 1, n, X.col(j).data() + k + 1);
+    }
+    Mpi::GlobalSum((k + 1 + n) * n, X.data(), comm);
+    const MatType Cp = X.topRows(k + 1);
+    const MatType G = X.bottomRows(n) - Cp.adjoint() * Cp;
+    Eigen::LLT<MatType> llt(G);
+    if (llt.info() != Eigen::Success)
+    {
+      return false;
+    }
+    const MatType Rp = llt.matrixU();
+    for (int j = 0; j < n; j++)
+    {
+      auto &w = V[k + 1 + j];
+      linalg::MAXPY(k + 1, Cp.col(j).data(), V.data(), w, -1.0);
+      linalg::MAXPY(j, Rp.col(j).data(), V.data() + k + 1, w, -1.0);
+      w *= 1.0 / Rp(j, j);
+    }
+    C += Cp * R;
+    R = Rp * R;
   }
-  constexpr int init_size = 5;
-  V.resize(max_dim + 1);
-  for (int j = 0; j < std::min(init_size, max_dim + 1); j++)
+
+  // With V(:, k:k+n) = V(:, 0:k+n) R̃, the Arnoldi relation gives the new columns of the
+  // Hessenberg matrix as H(:, k:k+n-1) = (R̃ B̂ - H(:, 0:k-1) R̃(0:k-1, :)) R̃ₖ⁻¹, where
+  // R̃ₖ = R̃(k:k+n-1, 0:n-1) is upper triangular.
+  MatType Rt = MatType::Zero(k + n + 1, n + 1);
+  Rt(k, 0) = 1.0;
+  Rt.block(0, 1, k + 1, n) = C;
+  Rt.block(k + 1, 1, n, n) = R;
+  MatType Hn = Rt * Bh;
+  if (k > 0)
   {
-    V[j].SetSize(A->Height());
-    V[j].UseDevice(true);
+    MatType Hk = MatType::Zero(k + n + 1, k);
+    for (int j = 0; j < k; j++)
+    {
+      for (int i = 0; i <= j + 1; i++)
+      {
+        Hk(i, j) = Hu[j * (max_dim + 1) + i];
+      }
+    }
+    Hn -= Hk * Rt.topLeftCorner(k, n);
   }
-  H.resize((max_dim + 1) * max_dim);
-  s.resize(max_dim + 1);
-  cs.resize(max_dim + 1);
-  sn.resize(max_dim + 1);
-}
-
-template <typename OperType>
-void GmresSolver<OperType>::Update(int j) const
-{
-  // Add storage for basis vectors in increments.
-  constexpr int add_size = 10;
-  for (int k = j + 1; k < std::min(j + 1 + add_size, max_dim + 1); k++)
+  const MatType Rk = Rt.block(k, 0, n, n);
+  Hn = Rk.template triangularView<Eigen::Upper>().template solve<Eigen::OnTheRight>(Hn);
+  for (int j = 0; j < n; j++)
   {
-    V[k].SetSize(A->Height());
-    V[k].UseDevice(true);
+    for (int i = 0; i <= k + j + 1; i++)
+    {
+      Hu[(k + j) * (max_dim + 1) + i] = Hn(i, j);
+    }
   }
+  return true;
 }
 
 template <typename OperType>
-void GmresSolver<OperType>::Mult(const VecType &b, VecType &x) const
+void SStepGmresSolver<OperType>::Mult(const VecType &b, VecType &x) const
 {
   // Set up workspace.
   RealType beta = 0.0, true_beta, eps = 0.0;
-  MFEM_VERIFY(A, "Operator must be set for GmresSolver::Mult!");
+  MFEM_VERIFY(A, "Operator must be set for SStepGmresSolver::Mult!");
   MFEM_ASSERT(A->Width() == x.Size() && A->Height() == b.Size(),
-              "Size mismatch for GmresSolver::Mult!");
+              "Size mismatch for SStepGmresSolver::Mult!");
+  MFEM_VERIFY(step_dim > 0, "s-step GMRES requires a positive step size!");
   r.SetSize(A->Height());
   r.UseDevice(true);
   Initialize();
 
+  // The Newton basis shifts are recomputed for each solve since the operator may change.
+  shifts.clear();
+
   // Begin iterations.
   converged = false;
   int it = 0, restart = 0;
   if (print_opts.iterations)
   {
-    Mpi::Print(comm, "{}Residual norms for GMRES solve\n",
+    Mpi::Print(comm, "{}Residual norms for s-step GMRES solve\n",
                std::string(tab_width + int_width - 1, ' '));
   }
   for (; it < max_it; restart++)
@@ -551,7 +2332,7 @@ void GmresSolver<OperType>::Mult(const VecType &b, VecType &x) const
     InitialResidual(pc_side, A, B, b, x, r, V[0], (this->initial_guess || restart > 0),
                     this->use_timer);
     true_beta = linalg::Norml2(comm, r);
-    CheckDot(true_beta, "GMRES residual norm is not valid: beta = ");
+    CheckDot(true_beta, "s-step GMRES residual norm is not valid: beta = ");
     if (it == 0)
     {
       if (this->initial_guess)
@@ -566,7 +2347,7 @@ void GmresSolver<OperType>::Mult(const VecType &b, VecType &x) const
         {
           beta_rhs = linalg::Norml2(comm, b);
         }
-        CheckDot(beta_rhs, "GMRES residual norm is not valid: beta_rhs = ");
+        CheckDot(beta_rhs, "s-step GMRES residual norm is not valid: beta_rhs = ");
         initial_res = beta_rhs;
       }
       else
@@ -580,8 +2361,8 @@ void GmresSolver<OperType>::Mult(const VecType &b, VecType &x) const
     {
       Mpi::Print(
           comm,
-          "{}GMRES residual at restart ({:.6e}) is far from the residual norm estimate "
-          "from the recursion formula ({:.6e}) (initial residual = {:.6e})\n",
+          "{}s-step GMRES residual at restart ({:.6e}) is far from the residual norm "
+          "estimate from the recursion formula ({:.6e}) (initial residual = {:.6e})\n",
           std::string(tab_width, ' '), true_beta, beta, initial_res);
     }
     beta = true_beta;
@@ -596,40 +2377,85 @@ void GmresSolver<OperType>::Mult(const VecType &b, VecType &x) const
     std::fill(s.begin(), s.end(), 0.0);
     s[0] = beta;
 
-    int j = 0;
-    for (;; j++, it++)
+    int j = 0, k = 0;
+    while (true)
     {
-      if (print_opts.iterations)
+      const int n = std::min({step_dim, max_dim - k, max_it - it});
+      for (int i = k; i < k + n; i++)
       {
-        Mpi::Print(comm, "{}{:{}d} (restart {:d}) KSP residual norm {:.6e}\n",
-                   std::string(tab_width, ' '), it, int_width, restart, beta);
+        if (V[i + 1].Size() == 0)
+        {
+          this->Update(i);
+        }
       }
-      VecType &w = V[j + 1];
-      if (w.Size() == 0)
+      if (shifts.empty() || !BlockArnoldi(k, n))
       {
-        Update(j);
+        // Standard Arnoldi iterations for the first block, which provide the Ritz values
+        // for the Newton basis shifts, or if the block basis is numerically rank deficient.
+        if (!shifts.empty() && print_opts.warnings)
+        {
+          Mpi::Print(comm,
+                     "{}s-step GMRES block basis is numerically rank deficient, using "
+                     "standard Arnoldi iterations\n",
+                     std::string(tab_width, ' '));
+        }
+        for (int i = k; i < k + n; i++)
+        {
+          VecType &w = V[i + 1];
+          ApplyBA(pc_side, A, B, V[i], w, r, this->use_timer);
+          ScalarType *Hi = Hu.data() + i * (max_dim + 1);
+          OrthogonalizeIteration(orthog_type, comm, V, w, Hi, i);
+          Hi[i + 1] = linalg::Norml2(comm, w);
+          w *= 1.0 / Hi[i + 1];
+        }
+        if (shifts.empty())
+        {
+          using MatType = Eigen::Matrix<ScalarType, Eigen::Dynamic, Eigen::Dynamic>;
+          MatType Hk = MatType::Zero(n, n);
+          for (int l = 0; l < n; l++)
+          {
+            for (int i = 0; i < std::min(l + 2, n); i++)
+            {
+              Hk(i, l) = Hu[(k + l) * (max_dim + 1) + k + i];
+            }
+          }
+          shifts = NewtonShifts(Hk, step_dim);
+        }
       }
-      ApplyBA(pc_side, A, B, V[j], w, r, this->use_timer);
-
-      ScalarType *Hj = H.data() + j * (max_dim + 1);
-      OrthogonalizeIteration(orthog_type, comm, V, w, Hj, j);
-      Hj[j + 1] = linalg::Norml2(comm, w);
-      w *= 1.0 / Hj[j + 1];
 
-      for (int k = 0; k < j; k++)
+      // Update the least squares problem with the new Hessenberg columns.
+      for (int i = 0; i < n; i++)
       {
-        ApplyPlaneRotation(Hj[k], Hj[k + 1], cs[k], sn[k]);
-      }
-      GeneratePlaneRotation(Hj[j], Hj[j + 1], cs[j], sn[j]);
-      ApplyPlaneRotation(Hj[j], Hj[j + 1], cs[j], sn[j]);
-      ApplyPlaneRotation(s[j], s[j + 1], cs[j], sn[j]);
+        j = k + i;
+        this->RecordIteration(it, beta);
+        if (print_opts.iterations)
+        {
+          Mpi::Print(comm, "{}{:{}d} (restart {:d}) KSP residual norm {:.6e}\n",
+                     std::string(tab_width, ' '), it, int_width, restart, beta);
+        }
+        const ScalarType *Huj = Hu.data() + j * (max_dim + 1);
+        ScalarType *Hj = H.data() + j * (max_dim + 1);
+        std::copy(Huj, Huj + j + 2, Hj);
+        for (int l = 0; l < j; l++)
+        {
+          ApplyPlaneRotation(Hj[l], Hj[l + 1], cs[l], sn[l]);
+        }
+        GeneratePlaneRotation(Hj[j], Hj[j + 1], cs[j], sn[j]);
+        ApplyPlaneRotation(Hj[j], Hj[j + 1], cs[j], sn[j]);
+        ApplyPlaneRotation(s[j], s[j + 1], cs[j], sn[j]);
 
-      beta = std::abs(s[j + 1]);
-      CheckDot(beta, "GMRES residual norm is not valid: beta = ");
-      converged = (beta < eps);
-      if (converged || j + 1 == max_dim || it + 1 == max_it)
-      {
+        beta = std::abs(s[j + 1]);
+        CheckDot(beta, "s-step GMRES residual norm is not valid: beta = ");
+        converged = (beta < eps);
         it++;
+        if (converged)
+        {
+          break;
+        }
+      }
+      k += n;
+      if (converged || k == max_dim || it == max_it)
+      {
         break;
       }
     }
@@ -639,25 +2465,19 @@ void GmresSolver<OperType>::Mult(const VecType &b, VecType &x) const
     {
       ScalarType *Hi = H.data() + i * (max_dim + 1);
       s[i] /= Hi[i];
-      for (int k = i - 1; k >= 0; k--)
+      for (int l = i - 1; l >= 0; l--)
       {
-        s[k] -= Hi[k] * s[i];
+        s[l] -= Hi[l] * s[i];
       }
     }
     if (!B || pc_side == PrecSide::LEFT)
     {
-      for (int k = 0; k <= j; k++)
-      {
-        x.Add(s[k], V[k]);
-      }
+      linalg::MAXPY(j + 1, s.data(), V.data(), x);
     }
     else  // B && pc_side == PrecSide::RIGHT
     {
       r = 0.0;
-      for (int k = 0; k <= j; k++)
-      {
-        r.Add(s[k], V[k]);
-      }
+      linalg::MAXPY(j + 1, s.data(), V.data(), r);
       ApplyB(B, r, V[0], this->use_timer);
       x += V[0];
     }
@@ -666,6 +2486,7 @@ void GmresSolver<OperType>::Mult(const VecType &b, VecType &x) const
       break;
     }
   }
+  this->RecordIteration(it, beta);
   if (print_opts.iterations)
   {
     Mpi::Print(comm, "{}{:{}d} (restart {:d}) KSP residual norm {:.6e}\n",
@@ -673,8 +2494,9 @@ void GmresSolver<OperType>::Mult(const VecType &b, VecType &x) const
   }
   if (print_opts.summary || (print_opts.warnings && eps > 0.0 && !converged))
   {
-    Mpi::Print(comm, "{}GMRES solver {} in {:d} iteration{}", std::string(tab_width, ' '),
-               converged ? "converged" : "did NOT converge", it, (it == 1) ? "" : "s");
+    Mpi::Print(comm, "{}s-step GMRES solver {} in {:d} iteration{}",
+               std::string(tab_width, ' '), converged ? "converged" : "did NOT converge",
+               it, (it == 1) ? "" : "s");
     if (it > 0)
     {
       Mpi::Print(comm, " (avg. reduction factor: {:.3e})\n",
@@ -690,62 +2512,174 @@ void GmresSolver<OperType>::Mult(const VecType &b, VecType &x) const
 }
 
 template <typename OperType>
-void FgmresSolver<OperType>::Initialize() const
+void GcroDrSolver<OperType>::Initialize() const
 {
   GmresSolver<OperType>::Initialize();
-  constexpr int init_size = 5;
-  Z.resize(max_dim + 1);
-  for (int j = 0; j < std::min(init_size, max_dim + 1); j++)
+  MFEM_VERIFY(recycle_dim > 0 && recycle_dim < max_dim,
+              "GCRO-DR recycled subspace dimension must be positive and less than the "
+              "restart dimension!");
+  if (Hr.empty())
   {
-    Z[j].SetSize(A->Height());
-    Z[j].UseDevice(true);
+    Hr.resize((max_dim + 1) * max_dim);
+    Bc.resize(recycle_dim * max_dim);
   }
 }
 
 template <typename OperType>
-void FgmresSolver<OperType>::Update(int j) const
+void GcroDrSolver<OperType>::UpdateRecycleOperator() const
 {
-  // Add storage for basis vectors in increments.
-  GmresSolver<OperType>::Update(j);
-  constexpr int add_size = 10;
-  for (int k = j + 1; k < std::min(j + 1 + add_size, max_dim + 1); k++)
+  // Compute C = (preconditioned) A U and orthonormalize with a QR factorization C = Q R,
+  // setting C ← Q and U ← U R⁻¹ to preserve the relation between the two.
+  std::vector<ScalarType> R(U.size());
+  for (std::size_t i = 0; i < U.size(); i++)
   {
-    Z[k].SetSize(A->Height());
-    Z[k].UseDevice(true);
+    ApplyBA(pc_side, A, B, U[i], C[i], r, this->use_timer);
+    OrthogonalizeIteration(orthog_type, comm, C, C[i], R.data(), static_cast<int>(i) - 1);
+    const RealType norm = linalg::Norml2(comm, C[i]);
+    if (norm == 0.0)
+    {
+      U.resize(i);
+      C.resize(i);
+      break;
+    }
+    C[i] *= 1.0 / norm;
+    for (std::size_t l = 0; l < i; l++)
+    {
+      U[i].Add(-R[l], U[l]);
+    }
+    U[i] *= 1.0 / norm;
   }
 }
 
 template <typename OperType>
-void FgmresSolver<OperType>::Mult(const VecType &b, VecType &x) const
+void GcroDrSolver<OperType>::UpdateRecycleSpace(int n) const
+{
+  // The Arnoldi relation for the cycle is M W = V̂ G, with W = [U, V(:, 1:n)],
+  // V̂ = [C, V(:, 1:n+1)], and G = [I, Bc; 0, H̄] in terms of the (unrotated) Hessenberg
+  // matrix H̄. The new recycled subspace is U = W P R⁻¹, C = V̂ Q, where G P = Q R and P
+  // contains the harmonic Ritz vectors.
+  using MatType = Eigen::Matrix<ScalarType, Eigen::Dynamic, Eigen::Dynamic>;
+  const int k = static_cast<int>(U.size());
+  const int m = k + n;
+  MatType G = MatType::Zero(m + 1, m), VW = MatType::Zero(m + 1, m);
+  for (int i = 0; i < k; i++)
+  {
+    G(i, i) = 1.0;
+  }
+  for (int j = 0; j < n; j++)
+  {
+    const ScalarType *Bj = Bc.data() + j * recycle_dim;
+    const ScalarType *Hj = Hr.data() + j * (max_dim + 1);
+    for (int i = 0; i < k; i++)
+    {
+      G(i, k + j) = Bj[i];
+    }
+    for (int i = 0; i <= j + 1; i++)
+    {
+      G(k + i, k + j) = Hj[i];
+    }
+  }
+
+  // VW = V̂ᴴ W = [Cᴴ U, 0; Vᴴ U, I; 0]. The leading k columns are contiguous in memory and
+  // can be reduced with a single global sum.
+  for (int j = 0; j < k; j++)
+  {
+    linalg::LocalMDot(U[j], C.data(), k, VW.col(j).data());
+    linalg::LocalMDot(U[j], V.data(), n + 1, VW.col(j).data() + k);
+  }
+  if (k > 0)
+  {
+    Mpi::GlobalSum((m + 1) * k, VW.data(), comm);
+  }
+  for (int j = 0; j < n; j++)
+  {
+    VW(k + j, k + j) = 1.0;
+  }
+
+  const MatType P = HarmonicRitzVectors(G, VW, recycle_dim);
+  const auto kn = P.cols();
+  Eigen::HouseholderQR<MatType> qr(G * P);
+  const MatType Q = qr.householderQ() * MatType::Identity(m + 1, kn);
+  const MatType R = qr.matrixQR().topLeftCorner(kn, kn);
+  const MatType Y =
+      R.template triangularView<Eigen::Upper>().template solve<Eigen::OnTheRight>(P);
+
+  std::vector<VecType> Un(kn), Cn(kn);
+  for (Eigen::Index i = 0; i < kn; i++)
+  {
+    Un[i].SetSize(A->Height());
+    Un[i].UseDevice(true);
+    Un[i] = 0.0;
+    Cn[i].SetSize(A->Height());
+    Cn[i].UseDevice(true);
+    Cn[i] = 0.0;
+    for (int l = 0; l < k; l++)
+    {
+      Un[i].Add(Y(l, i), U[l]);
+      Cn[i].Add(Q(l, i), C[l]);
+    }
+    for (int l = 0; l < n; l++)
+    {
+      Un[i].Add(Y(k + l, i), V[l]);
+    }
+    for (int l = 0; l <= n; l++)
+    {
+      Cn[i].Add(Q(k + l, i), V[l]);
+    }
+  }
+  U = std::move(Un);
+  C = std::move(Cn);
+}
+
+template <typename OperType>
+void GcroDrSolver<OperType>::Mult(const VecType &b, VecType &x) const
 {
   // Set up workspace.
   RealType beta = 0.0, true_beta, eps = 0.0;
-  MFEM_VERIFY(A && B, "Operator and preconditioner must be set for FgmresSolver::Mult!");
+  MFEM_VERIFY(A, "Operator must be set for GcroDrSolver::Mult!");
   MFEM_ASSERT(A->Width() == x.Size() && A->Height() == b.Size(),
-              "Size mismatch for FgmresSolver::Mult!");
+              "Size mismatch for GcroDrSolver::Mult!");
+  r.SetSize(A->Height());
+  r.UseDevice(true);
+  z.SetSize(A->Height());
+  z.UseDevice(true);
   Initialize();
+  if (update_C)
+  {
+    UpdateRecycleOperator();
+    update_C = false;
+  }
 
   // Begin iterations.
   converged = false;
   int it = 0, restart = 0;
   if (print_opts.iterations)
   {
-    Mpi::Print(comm, "{}Residual norms for FGMRES solve\n",
+    Mpi::Print(comm, "{}Residual norms for GCRO-DR solve\n",
                std::string(tab_width + int_width - 1, ' '));
   }
   for (; it < max_it; restart++)
   {
     // Initialize.
-    InitialResidual(PrecSide::RIGHT, A, B, b, x, Z[0], V[0],
-                    (this->initial_guess || restart > 0), this->use_timer);
-    true_beta = linalg::Norml2(comm, Z[0]);
-    CheckDot(true_beta, "FGMRES residual norm is not valid: beta = ");
+    InitialResidual(pc_side, A, B, b, x, r, V[0], (this->initial_guess || restart > 0),
+                    this->use_timer);
+    true_beta = linalg::Norml2(comm, r);
+    CheckDot(true_beta, "GCRO-DR residual norm is not valid: beta = ");
     if (it == 0)
     {
       if (this->initial_guess)
       {
-        auto beta_rhs = linalg::Norml2(comm, b);
-        CheckDot(beta_rhs, "GMRES residual norm is not valid: beta_rhs = ");
+        RealType beta_rhs;
+        if (B && pc_side == PrecSide::LEFT)
+        {
+          ApplyB(B, b, V[0], this->use_timer);
+          beta_rhs = linalg::Norml2(comm, V[0]);
+        }
+        else  // !B || pc_side == PrecSide::RIGHT
+        {
+          beta_rhs = linalg::Norml2(comm, b);
+        }
+        CheckDot(beta_rhs, "GCRO-DR residual norm is not valid: beta_rhs = ");
         initial_res = beta_rhs;
       }
       else
@@ -759,11 +2693,33 @@ void FgmresSolver<OperType>::Mult(const VecType &b, VecType &x) const
     {
       Mpi::Print(
           comm,
-          "{}FGMRES residual at restart ({:.6e}) is far from the residual norm estimate "
+          "{}GCRO-DR residual at restart ({:.6e}) is far from the residual norm estimate "
           "from the recursion formula ({:.6e}) (initial residual = {:.6e})\n",
           std::string(tab_width, ' '), true_beta, beta, initial_res);
     }
     beta = true_beta;
+
+    // Project the residual onto the orthogonal complement of the recycled subspace:
+    // x ← x + U Cᴴ r, r ← r - C Cᴴ r.
+    const int k = static_cast<int>(U.size());
+    if (k > 0)
+    {
+      linalg::MDot(comm, r, C.data(), k, s.data());
+      z = 0.0;
+      linalg::MAXPY(k, s.data(), C.data(), r, -1.0);
+      linalg::MAXPY(k, s.data(), U.data(), z);
+      if (!B || pc_side == PrecSide::LEFT)
+      {
+        x += z;
+      }
+      else  // B && pc_side == PrecSide::RIGHT
+      {
+        ApplyB(B, z, V[0], this->use_timer);
+        x += V[0];
+      }
+      beta = linalg::Norml2(comm, r);
+      CheckDot(beta, "GCRO-DR residual norm is not valid: beta = ");
+    }
     if (beta < eps)
     {
       converged = true;
@@ -771,13 +2727,14 @@ void FgmresSolver<OperType>::Mult(const VecType &b, VecType &x) const
     }
 
     V[0] = 0.0;
-    V[0].Add(1.0 / beta, Z[0]);
+    V[0].Add(1.0 / beta, r);
     std::fill(s.begin(), s.end(), 0.0);
     s[0] = beta;
 
     int j = 0;
     for (;; j++, it++)
     {
+      this->RecordIteration(it, beta);
       if (print_opts.iterations)
       {
         Mpi::Print(comm, "{}{:{}d} (restart {:d}) KSP residual norm {:.6e}\n",
@@ -786,27 +2743,34 @@ void FgmresSolver<OperType>::Mult(const VecType &b, VecType &x) const
       VecType &w = V[j + 1];
       if (w.Size() == 0)
       {
-        Update(j);
+        this->Update(j);
       }
-      ApplyBA(PrecSide::RIGHT, A, B, V[j], w, Z[j], this->use_timer);
+      ApplyBA(pc_side, A, B, V[j], w, r, this->use_timer);
 
+      // Orthogonalize against the recycled subspace, and then the Krylov basis.
+      if (k > 0)
+      {
+        ScalarType *Bj = Bc.data() + j * recycle_dim;
+        OrthogonalizeIteration(orthog_type, comm, C, w, Bj, k - 1);
+      }
       ScalarType *Hj = H.data() + j * (max_dim + 1);
       OrthogonalizeIteration(orthog_type, comm, V, w, Hj, j);
       Hj[j + 1] = linalg::Norml2(comm, w);
       w *= 1.0 / Hj[j + 1];
+      std::copy(Hj, Hj + j + 2, Hr.data() + j * (max_dim + 1));
 
-      for (int k = 0; k < j; k++)
+      for (int l = 0; l < j; l++)
       {
-        ApplyPlaneRotation(Hj[k], Hj[k + 1], cs[k], sn[k]);
+        ApplyPlaneRotation(Hj[l], Hj[l + 1], cs[l], sn[l]);
       }
       GeneratePlaneRotation(Hj[j], Hj[j + 1], cs[j], sn[j]);
       ApplyPlaneRotation(Hj[j], Hj[j + 1], cs[j], sn[j]);
       ApplyPlaneRotation(s[j], s[j + 1], cs[j], sn[j]);
 
       beta = std::abs(s[j + 1]);
-      CheckDot(beta, "FGMRES residual norm is not valid: beta = ");
+      CheckDot(beta, "GCRO-DR residual norm is not valid: beta = ");
       converged = (beta < eps);
-      if (converged || j + 1 == max_dim || it + 1 == max_it)
+      if (converged || j + 1 == max_dim - k || it + 1 == max_it)
       {
         it++;
         break;
@@ -814,24 +2778,46 @@ void FgmresSolver<OperType>::Mult(const VecType &b, VecType &x) const
     }
 
     // Reconstruct the solution (for restart or due to convergence or maximum iterations).
+    // The least squares problem decouples as y₂ = argmin ||β e₁ - H̄ y₂|| and y₁ = -Bc y₂
+    // for the coefficients of the Krylov basis and recycled subspace, respectively.
     for (int i = j; i >= 0; i--)
     {
       ScalarType *Hi = H.data() + i * (max_dim + 1);
       s[i] /= Hi[i];
-      for (int k = i - 1; k >= 0; k--)
+      for (int l = i - 1; l >= 0; l--)
       {
-        s[k] -= Hi[k] * s[i];
+        s[l] -= Hi[l] * s[i];
+      }
+    }
+    z = 0.0;
+    linalg::MAXPY(j + 1, s.data(), V.data(), z);
+    for (int i = 0; i < k; i++)
+    {
+      ScalarType y = 0.0;
+      for (int l = 0; l <= j; l++)
+      {
+        y -= Bc[l * recycle_dim + i] * s[l];
       }
+      z.Add(y, U[i]);
+    }
+    if (!B || pc_side == PrecSide::LEFT)
+    {
+      x += z;
     }
-    for (int k = 0; k <= j; k++)
+    else  // B && pc_side == PrecSide::RIGHT
     {
-      x.Add(s[k], Z[k]);
+      ApplyB(B, z, r, this->use_timer);
+      x += r;
     }
+
+    // Update the recycled subspace for the next cycle or call to Mult.
+    UpdateRecycleSpace(j + 1);
     if (converged)
     {
       break;
     }
   }
+  this->RecordIteration(it, beta);
   if (print_opts.iterations)
   {
     Mpi::Print(comm, "{}{:{}d} (restart {:d}) KSP residual norm {:.6e}\n",
@@ -839,8 +2825,9 @@ void FgmresSolver<OperType>::Mult(const VecType &b, VecType &x) const
   }
   if (print_opts.summary || (print_opts.warnings && eps > 0.0 && !converged))
   {
-    Mpi::Print(comm, "{}FGMRES solver {} in {:d} iteration{}", std::string(tab_width, ' '),
-               converged ? "converged" : "did NOT converge", it, (it == 1) ? "" : "s");
+    Mpi::Print(comm, "{}GCRO-DR solver {} in {:d} iteration{}",
+               std::string(tab_width, ' '), converged ? "converged" : "did NOT converge",
+               it, (it == 1) ? "" : "s");
     if (it > 0)
     {
       Mpi::Print(comm, " (avg. reduction factor: {:.3e})\n",
@@ -859,9 +2846,25 @@ template class IterativeSolver<Operator>;
 template class IterativeSolver<ComplexOperator>;
 template class CgSolver<Operator>;
 template class CgSolver<ComplexOperator>;
+template class DeflatedCgSolver<Operator>;
+template class DeflatedCgSolver<ComplexOperator>;
+template class MinResSolver<Operator>;
+template class MinResSolver<ComplexOperator>;
+template class BiCGStabSolver<Operator>;
+template class BiCGStabSolver<ComplexOperator>;
+template class CocgSolver<Operator>;
+template class CocgSolver<ComplexOperator>;
+template class CocrSolver<Operator>;
+template class CocrSolver<ComplexOperator>;
 template class GmresSolver<Operator>;
 template class GmresSolver<ComplexOperator>;
 template class FgmresSolver<Operator>;
 template class FgmresSolver<ComplexOperator>;
+template class PgmresSolver<Operator>;
+template class PgmresSolver<ComplexOperator>;
+template class SStepGmresSolver<Operator>;
+template class SStepGmresSolver<ComplexOperator>;
+template class GcroDrSolver<Operator>;
+template class GcroDrSolver<ComplexOperator>;
 
 }  // namespace palace
@@ -9,6 +9,7 @@
 #include <mfem.hpp>
 #include "linalg/operator.hpp"
 #include "linalg/solver.hpp"
+#include "linalg/telemetry.hpp"
 #include "linalg/vector.hpp"
 
 namespace palace
@@ -56,6 +57,18 @@ protected:
   // Enable timer contribution for Timer::PRECONDITIONER.
   bool use_timer;
 
+  // Optional per-iteration telemetry recording (not owned).
+  SolverTelemetry *telemetry;
+
+  // Record the residual norm for the given iteration to the telemetry, if enabled.
+  void RecordIteration(int it, double res) const
+  {
+    if (telemetry)
+    {
+      telemetry->RecordIteration(it, res);
+    }
+  }
+
 public:
   IterativeSolver(MPI_Comm comm, int print);
 
@@ -105,6 +118,9 @@ public:
 
   // Activate preconditioner timing during solves.
   void EnableTimer() { use_timer = true; }
+
+  // Set the telemetry object recording the residual history of solves.
+  void SetTelemetry(SolverTelemetry *tel) { telemetry = tel; }
 };
 
 // Preconditioned Conjugate Gradient (CG) method for SPD linear systems.
@@ -142,6 +158,254 @@ public:
   void Mult(const VecType &b, VecType &x) const override;
 };
 
+// Deflated preconditioned Conjugate Gradient method for sequences of SPD linear systems
+// with the same operator and different right-hand sides. The search directions are kept
+// A-orthogonal to a deflation subspace W, which is built up across consecutive calls to
+// Mult from Ritz vectors for the smallest eigenvalues of the preconditioned operator,
+// extracted from the Lanczos relation of each solve. See Saad et al., A deflated version of
+// the conjugate gradient algorithm, SIAM J. Sci. Comput. (2000).
+template <typename OperType>
+class DeflatedCgSolver : public CgSolver<OperType>
+{
+protected:
+  using VecType = typename CgSolver<OperType>::VecType;
+  using RealType = typename CgSolver<OperType>::RealType;
+  using ScalarType = typename CgSolver<OperType>::ScalarType;
+
+  using CgSolver<OperType>::comm;
+  using CgSolver<OperType>::print_opts;
+  using CgSolver<OperType>::int_width;
+  using CgSolver<OperType>::tab_width;
+
+  using CgSolver<OperType>::rel_tol;
+  using CgSolver<OperType>::abs_tol;
+  using CgSolver<OperType>::max_it;
+
+  using CgSolver<OperType>::A;
+  using CgSolver<OperType>::B;
+
+  using CgSolver<OperType>::converged;
+  using CgSolver<OperType>::initial_res;
+  using CgSolver<OperType>::final_res;
+  using CgSolver<OperType>::final_it;
+
+  using CgSolver<OperType>::r;
+  using CgSolver<OperType>::z;
+  using CgSolver<OperType>::p;
+
+  // Maximum dimension of the deflation subspace.
+  int recycle_dim;
+
+  // Deflation subspace W and its image A W, which persist across calls to Mult, and the
+  // Galerkin matrix E = Wᴴ A W (stored column-major).
+  mutable std::vector<VecType> W, AW;
+  mutable std::vector<ScalarType> E;
+
+  // Flag for whether or not A W needs to be recomputed for a new operator.
+  mutable bool update_AW;
+
+  // Lanczos vectors and CG coefficients from the current solve, used to extend the
+  // deflation subspace.
+  mutable std::vector<VecType> L;
+  mutable std::vector<RealType> L_alpha, L_beta;
+
+  // Recompute A W and E for the current operator.
+  void UpdateDeflationOperator() const;
+
+  // Extend the deflation subspace with Ritz vectors from the first n Lanczos vectors of the
+  // most recent solve.
+  void UpdateDeflationSpace(int n) const;
+
+public:
+  DeflatedCgSolver(MPI_Comm comm, int print)
+    : CgSolver<OperType>(comm, print), recycle_dim(10), update_AW(false)
+  {
+  }
+
+  // Set the maximum dimension of the deflation subspace.
+  void SetRecycleDim(int dim) { recycle_dim = dim; }
+
+  // Discard the deflation subspace.
+  void ClearRecycleSpace()
+  {
+    W.clear();
+    AW.clear();
+    E.clear();
+  }
+
+  void SetOperator(const OperType &op) override
+  {
+    CgSolver<OperType>::SetOperator(op);
+    if (!W.empty() && W[0].Size() != op.Height())
+    {
+      ClearRecycleSpace();
+    }
+    update_AW = true;
+  }
+
+  void Mult(const VecType &b, VecType &x) const override;
+};
+
+// Preconditioned Minimal Residual (MINRES) method for symmetric (possibly indefinite)
+// linear systems. For complex-valued systems, the operator is assumed to be complex
+// symmetric (not Hermitian) and the Lanczos process of Saunders, Simon, and Yip (1988) is
+// used, see Choi, Minimal residual methods for complex symmetric, skew symmetric, and skew
+// Hermitian systems, arXiv:1304.6782 (2013). The preconditioner must be symmetric positive
+// definite, and real-valued in the complex case (acting identically on the real and
+// imaginary parts).
+template <typename OperType>
+class MinResSolver : public IterativeSolver<OperType>
+{
+protected:
+  using VecType = typename Solver<OperType>::VecType;
+  using RealType = typename IterativeSolver<OperType>::RealType;
+  using ScalarType = typename IterativeSolver<OperType>::ScalarType;
+
+  using IterativeSolver<OperType>::comm;
+  using IterativeSolver<OperType>::print_opts;
+  using IterativeSolver<OperType>::int_width;
+  using IterativeSolver<OperType>::tab_width;
+
+  using IterativeSolver<OperType>::rel_tol;
+  using IterativeSolver<OperType>::abs_tol;
+  using IterativeSolver<OperType>::max_it;
+
+  using IterativeSolver<OperType>::A;
+  using IterativeSolver<OperType>::B;
+
+  using IterativeSolver<OperType>::converged;
+  using IterativeSolver<OperType>::initial_res;
+  using IterativeSolver<OperType>::final_res;
+  using IterativeSolver<OperType>::final_it;
+
+  // Temporary workspace for solve (three-term recurrences for the Lanczos vectors and
+  // search directions).
+  mutable VecType u[3], w[3], z;
+
+public:
+  MinResSolver(MPI_Comm comm, int print) : IterativeSolver<OperType>(comm, print) {}
+
+  void Mult(const VecType &b, VecType &x) const override;
+};
+
+// Preconditioned Biconjugate Gradient Stabilized (BiCGSTAB) method for general
+// nonsymmetric linear systems, with right preconditioning. For complex-valued systems the
+// shadow residual is chosen as the complex conjugate of the initial residual, which for
+// complex symmetric operators makes the underlying biorthogonalization coincide with the
+// conjugate orthogonal (COCG) Lanczos process.
+template <typename OperType>
+class BiCGStabSolver : public IterativeSolver<OperType>
+{
+protected:
+  using VecType = typename Solver<OperType>::VecType;
+  using RealType = typename IterativeSolver<OperType>::RealType;
+  using ScalarType = typename IterativeSolver<OperType>::ScalarType;
+
+  using IterativeSolver<OperType>::comm;
+  using IterativeSolver<OperType>::print_opts;
+  using IterativeSolver<OperType>::int_width;
+  using IterativeSolver<OperType>::tab_width;
+
+  using IterativeSolver<OperType>::rel_tol;
+  using IterativeSolver<OperType>::abs_tol;
+  using IterativeSolver<OperType>::max_it;
+
+  using IterativeSolver<OperType>::A;
+  using IterativeSolver<OperType>::B;
+
+  using IterativeSolver<OperType>::converged;
+  using IterativeSolver<OperType>::initial_res;
+  using IterativeSolver<OperType>::final_res;
+  using IterativeSolver<OperType>::final_it;
+
+  // Temporary workspace for solve.
+  mutable VecType r, rh, p, v, t, z;
+
+public:
+  BiCGStabSolver(MPI_Comm comm, int print) : IterativeSolver<OperType>(comm, print) {}
+
+  void Mult(const VecType &b, VecType &x) const override;
+};
+
+// Preconditioned Conjugate Orthogonal Conjugate Gradient (COCG) method for complex
+// symmetric (Aᵀ = A) linear systems, see van der Vorst and Melissen, A Petrov-Galerkin type
+// method for solving Ax = b, where A is symmetric complex, IEEE Trans. Magn. (1990). It is
+// CG with the indefinite inner product yᵀ x in place of yᴴ x, and reduces to CG for
+// real-valued systems. The preconditioner must be complex symmetric (for example real
+// symmetric).
+template <typename OperType>
+class CocgSolver : public IterativeSolver<OperType>
+{
+protected:
+  using VecType = typename Solver<OperType>::VecType;
+  using RealType = typename IterativeSolver<OperType>::RealType;
+  using ScalarType = typename IterativeSolver<OperType>::ScalarType;
+
+  using IterativeSolver<OperType>::comm;
+  using IterativeSolver<OperType>::print_opts;
+  using IterativeSolver<OperType>::int_width;
+  using IterativeSolver<OperType>::tab_width;
+
+  using IterativeSolver<OperType>::rel_tol;
+  using IterativeSolver<OperType>::abs_tol;
+  using IterativeSolver<OperType>::max_it;
+
+  using IterativeSolver<OperType>::A;
+  using IterativeSolver<OperType>::B;
+
+  using IterativeSolver<OperType>::converged;
+  using IterativeSolver<OperType>::initial_res;
+  using IterativeSolver<OperType>::final_res;
+  using IterativeSolver<OperType>::final_it;
+
+  // Temporary workspace for solve.
+  mutable VecType r, z, p;
+
+public:
+  CocgSolver(MPI_Comm comm, int print) : IterativeSolver<OperType>(comm, print) {}
+
+  void Mult(const VecType &b, VecType &x) const override;
+};
+
+// Preconditioned Conjugate Orthogonal Conjugate Residual (COCR) method for complex
+// symmetric linear systems, see Sogabe and Zhang, A COCR method for solving complex
+// symmetric linear systems, J. Comput. Appl. Math. (2007). Compared to COCG, the residual
+// norm history is typically smoother at the cost of one additional vector of storage. The
+// preconditioner must be complex symmetric.
+template <typename OperType>
+class CocrSolver : public IterativeSolver<OperType>
+{
+protected:
+  using VecType = typename Solver<OperType>::VecType;
+  using RealType = typename IterativeSolver<OperType>::RealType;
+  using ScalarType = typename IterativeSolver<OperType>::ScalarType;
+
+  using IterativeSolver<OperType>::comm;
+  using IterativeSolver<OperType>::print_opts;
+  using IterativeSolver<OperType>::int_width;
+  using IterativeSolver<OperType>::tab_width;
+
+  using IterativeSolver<OperType>::rel_tol;
+  using IterativeSolver<OperType>::abs_tol;
+  using IterativeSolver<OperType>::max_it;
+
+  using IterativeSolver<OperType>::A;
+  using IterativeSolver<OperType>::B;
+
+  using IterativeSolver<OperType>::converged;
+  using IterativeSolver<OperType>::initial_res;
+  using IterativeSolver<OperType>::final_res;
+  using IterativeSolver<OperType>::final_it;
+
+  // Temporary workspace for solve.
+  mutable VecType r, u, p, q, w, z;
+
+public:
+  CocrSolver(MPI_Comm comm, int print) : IterativeSolver<OperType>(comm, print) {}
+
+  void Mult(const VecType &b, VecType &x) const override;
+};
+
 // Base class defining enums for GMRES.
 class GmresSolverBase
 {
@@ -197,6 +461,15 @@ protected:
   // Use left or right preconditioning.
   PrecSide pc_side;
 
+  // Optional linear functionals of the solution qᵢ = lᵢᵀ x - cᵢ (not owned), with constant
+  // offsets cᵢ, the group of each functional and the nominal magnitude of the quantities in
+  // each group, and the relative tolerance for stopping once their values have converged.
+  const std::vector<VecType> *qoi_funcs;
+  std::vector<double> qoi_offsets;
+  std::vector<int> qoi_groups;
+  std::vector<double> qoi_scales;
+  double qoi_tol;
+
   // Temporary workspace for solve.
   mutable std::vector<VecType> V;
   mutable VecType r;
@@ -204,6 +477,12 @@ protected:
   mutable std::vector<ScalarType> s, sn;
   mutable std::vector<RealType> cs;
 
+  // Temporary workspace for the quantity of interest stopping criterion: the functionals
+  // applied to the Krylov basis vectors and to the solution at restart, the current values,
+  // the current iterate coefficients, and the magnitude floor for each group.
+  mutable std::vector<ScalarType> qoi_V, qoi_x, qoi_q, qoi_y, qoi_dot;
+  mutable std::vector<RealType> qoi_floor;
+
   // Allocate storage for solve.
   virtual void Initialize() const;
   virtual void Update(int j) const;
@@ -211,7 +490,7 @@ protected:
 public:
   GmresSolver(MPI_Comm comm, int print)
     : IterativeSolver<OperType>(comm, print), max_dim(-1), orthog_type(OrthogType::MGS),
-      pc_side(PrecSide::LEFT)
+      pc_side(PrecSide::LEFT), qoi_funcs(nullptr), qoi_tol(0.0)
   {
   }
 
@@ -224,6 +503,26 @@ public:
   // Set the side for preconditioning.
   virtual void SetPrecSide(PrecSide side) { pc_side = side; }
 
+  // Set linear functionals of the solution, and stop the solve also once the change in each
+  // of their values over consecutive iterations is below the given relative tolerance and
+  // the residual has been reduced by at least the same factor. The magnitude of each
+  // quantity is measured after subtracting its offset. Quantities are normalized within
+  // their group, and the scale of group g is at least scales[g] (zero for quantities with
+  // no nominal magnitude). Only used by the standard GMRES solver with left
+  // preconditioning.
+  void SetQoIFunctionals(const std::vector<VecType> &funcs,
+                         const std::vector<double> &offsets, const std::vector<int> &groups,
+                         const std::vector<double> &scales, double tol)
+  {
+    MFEM_VERIFY(offsets.size() == funcs.size() && groups.size() == funcs.size(),
+                "Invalid offsets or group indices for quantity of interest functionals!");
+    qoi_funcs = &funcs;
+    qoi_offsets = offsets;
+    qoi_groups = groups;
+    qoi_scales = scales;
+    qoi_tol = tol;
+  }
+
   void Mult(const VecType &b, VecType &x) const override;
 };
 
@@ -289,6 +588,241 @@ public:
   void Mult(const VecType &b, VecType &x) const override;
 };
 
+// Pipelined Generalized Minimum Residual Method (p(1)-GMRES) for general nonsymmetric
+// linear systems. The global reduction for the classical Gram-Schmidt orthogonalization of
+// each new Krylov vector is overlapped with the next preconditioned operator application,
+// which is computed before the basis vector is known and corrected afterwards using the
+// Arnoldi relation. This hides the latency of the reductions at the expense of additional
+// vector updates and somewhat reduced numerical stability compared to GMRES. See Ghysels
+// et al., Hiding global communication latency in the GMRES algorithm on massively parallel
+// machines, SIAM J. Sci. Comput. (2013).
+template <typename OperType>
+class PgmresSolver : public GmresSolver<OperType>
+{
+public:
+  using OrthogType = typename GmresSolverBase::OrthogType;
+  using PrecSide = typename GmresSolverBase::PrecSide;
+
+protected:
+  using VecType = typename GmresSolver<OperType>::VecType;
+  using RealType = typename GmresSolver<OperType>::RealType;
+  using ScalarType = typename GmresSolver<OperType>::ScalarType;
+
+  using GmresSolver<OperType>::comm;
+  using GmresSolver<OperType>::print_opts;
+  using GmresSolver<OperType>::int_width;
+  using GmresSolver<OperType>::tab_width;
+
+  using GmresSolver<OperType>::rel_tol;
+  using GmresSolver<OperType>::abs_tol;
+  using GmresSolver<OperType>::max_it;
+
+  using GmresSolver<OperType>::A;
+  using GmresSolver<OperType>::B;
+
+  using GmresSolver<OperType>::converged;
+  using GmresSolver<OperType>::initial_res;
+  using GmresSolver<OperType>::final_res;
+  using GmresSolver<OperType>::final_it;
+
+  using GmresSolver<OperType>::max_dim;
+  using GmresSolver<OperType>::pc_side;
+  using GmresSolver<OperType>::V;
+  using GmresSolver<OperType>::r;
+  using GmresSolver<OperType>::H;
+  using GmresSolver<OperType>::s;
+  using GmresSolver<OperType>::sn;
+  using GmresSolver<OperType>::cs;
+
+  // Temporary workspace for solve: The unorthogonalized Krylov vector, its image under the
+  // preconditioned operator, and the Hessenberg matrix before the Givens rotations.
+  mutable VecType z, w;
+  mutable std::vector<ScalarType> Hu;
+
+  // Allocate storage for solve.
+  void Initialize() const override;
+
+public:
+  PgmresSolver(MPI_Comm comm, int print) : GmresSolver<OperType>(comm, print)
+  {
+    this->orthog_type = OrthogType::CGS;
+  }
+
+  void Mult(const VecType &b, VecType &x) const override;
+};
+
+// Communication-avoiding s-step Generalized Minimum Residual Method for general
+// nonsymmetric linear systems. Blocks of s Krylov vectors are generated using a Newton
+// polynomial basis, with shifts given by Leja-ordered Ritz values from an initial cycle of
+// standard Arnoldi iterations, and orthogonalized as a block against the existing basis
+// using block classical Gram-Schmidt with Cholesky QR. This requires one (CGS) or two (MGS
+// and CGS2) global reductions per block instead of per iteration. See Hoemmen,
+// Communication-avoiding Krylov subspace methods, Ph.D. thesis (2010).
+template <typename OperType>
+class SStepGmresSolver : public GmresSolver<OperType>
+{
+public:
+  using OrthogType = typename GmresSolverBase::OrthogType;
+  using PrecSide = typename GmresSolverBase::PrecSide;
+
+protected:
+  using VecType = typename GmresSolver<OperType>::VecType;
+  using RealType = typename GmresSolver<OperType>::RealType;
+  using ScalarType = typename GmresSolver<OperType>::ScalarType;
+
+  using GmresSolver<OperType>::comm;
+  using GmresSolver<OperType>::print_opts;
+  using GmresSolver<OperType>::int_width;
+  using GmresSolver<OperType>::tab_width;
+
+  using GmresSolver<OperType>::rel_tol;
+  using GmresSolver<OperType>::abs_tol;
+  using GmresSolver<OperType>::max_it;
+
+  using GmresSolver<OperType>::A;
+  using GmresSolver<OperType>::B;
+
+  using GmresSolver<OperType>::converged;
+  using GmresSolver<OperType>::initial_res;
+  using GmresSolver<OperType>::final_res;
+  using GmresSolver<OperType>::final_it;
+
+  using GmresSolver<OperType>::max_dim;
+  using GmresSolver<OperType>::orthog_type;
+  using GmresSolver<OperType>::pc_side;
+  using GmresSolver<OperType>::V;
+  using GmresSolver<OperType>::r;
+  using GmresSolver<OperType>::H;
+  using GmresSolver<OperType>::s;
+  using GmresSolver<OperType>::sn;
+  using GmresSolver<OperType>::cs;
+
+  // Number of Krylov vectors generated per block.
+  int step_dim;
+
+  // Temporary workspace for solve: The Hessenberg matrix before the Givens rotations and
+  // the shifts for the Newton basis.
+  mutable std::vector<ScalarType> Hu;
+  mutable std::vector<std::complex<double>> shifts;
+
+  // Allocate storage for solve.
+  void Initialize() const override;
+
+  // Generate the next block of n basis vectors V(:, k+1:k+n) from V(:, k) and compute the
+  // corresponding columns of the Hessenberg matrix. Returns false if the block basis is
+  // numerically rank deficient.
+  bool BlockArnoldi(int k, int n) const;
+
+public:
+  SStepGmresSolver(MPI_Comm comm, int print)
+    : GmresSolver<OperType>(comm, print), step_dim(5)
+  {
+  }
+
+  // Set the number of Krylov vectors generated per block.
+  void SetStepDim(int dim) { step_dim = dim; }
+
+  void Mult(const VecType &b, VecType &x) const override;
+};
+
+// Generalized Conjugate Residual method with inner Orthogonalization and Deflated
+// Restarting (GCRO-DR) for sequences of general nonsymmetric linear systems. A subspace
+// spanned by harmonic Ritz vectors is recycled across restarts and consecutive calls to
+// Mult, so that the solver does not need to rediscover the slowly converging spectral
+// components for each new right-hand side or nearby operator. See Parks et al., Recycling
+// Krylov subspaces for sequences of linear systems, SIAM J. Sci. Comput. (2006).
+template <typename OperType>
+class GcroDrSolver : public GmresSolver<OperType>
+{
+public:
+  using OrthogType = typename GmresSolverBase::OrthogType;
+  using PrecSide = typename GmresSolverBase::PrecSide;
+
+protected:
+  using VecType = typename GmresSolver<OperType>::VecType;
+  using RealType = typename GmresSolver<OperType>::RealType;
+  using ScalarType = typename GmresSolver<OperType>::ScalarType;
+
+  using GmresSolver<OperType>::comm;
+  using GmresSolver<OperType>::print_opts;
+  using GmresSolver<OperType>::int_width;
+  using GmresSolver<OperType>::tab_width;
+
+  using GmresSolver<OperType>::rel_tol;
+  using GmresSolver<OperType>::abs_tol;
+  using GmresSolver<OperType>::max_it;
+
+  using GmresSolver<OperType>::A;
+  using GmresSolver<OperType>::B;
+
+  using GmresSolver<OperType>::converged;
+  using GmresSolver<OperType>::initial_res;
+  using GmresSolver<OperType>::final_res;
+  using GmresSolver<OperType>::final_it;
+
+  using GmresSolver<OperType>::max_dim;
+  using GmresSolver<OperType>::orthog_type;
+  using GmresSolver<OperType>::pc_side;
+  using GmresSolver<OperType>::V;
+  using GmresSolver<OperType>::r;
+  using GmresSolver<OperType>::H;
+  using GmresSolver<OperType>::s;
+  using GmresSolver<OperType>::sn;
+  using GmresSolver<OperType>::cs;
+
+  // Maximum dimension of the recycled subspace.
+  int recycle_dim;
+
+  // Recycled subspace U and its image C = (preconditioned) A U, with orthonormal columns,
+  // which persist across calls to Mult.
+  mutable std::vector<VecType> U, C;
+
+  // Flag for whether or not C needs to be recomputed for a new operator.
+  mutable bool update_C;
+
+  // Temporary workspace for solve.
+  mutable VecType z;
+  mutable std::vector<ScalarType> Hr, Bc;
+
+  // Allocate storage for solve.
+  void Initialize() const override;
+
+  // Recompute and orthonormalize C for the current operator and preconditioner.
+  void UpdateRecycleOperator() const;
+
+  // Update the recycled subspace with harmonic Ritz vectors from the Arnoldi relation of
+  // the most recent cycle of n iterations.
+  void UpdateRecycleSpace(int n) const;
+
+public:
+  GcroDrSolver(MPI_Comm comm, int print)
+    : GmresSolver<OperType>(comm, print), recycle_dim(10), update_C(false)
+  {
+  }
+
+  // Set the maximum dimension of the recycled subspace.
+  void SetRecycleDim(int dim) { recycle_dim = dim; }
+
+  // Discard the recycled subspace.
+  void ClearRecycleSpace()
+  {
+    U.clear();
+    C.clear();
+  }
+
+  void SetOperator(const OperType &op) override
+  {
+    GmresSolver<OperType>::SetOperator(op);
+    if (!U.empty() && U[0].Size() != op.Height())
+    {
+      ClearRecycleSpace();
+    }
+    update_C = true;
+  }
+
+  void Mult(const VecType &b, VecType &x) const override;
+};
+
 }  // namespace palace
 
 #endif  // PALACE_LINALG_ITERATIVE_HPP
@@ -3,13 +3,16 @@
 
 #include "ksp.hpp"
 
+#include <algorithm>
 #include <mfem.hpp>
 #include "fem/fespace.hpp"
+#include "linalg/agglomeration.hpp"
 #include "linalg/amg.hpp"
 #include "linalg/ams.hpp"
 #include "linalg/gmg.hpp"
 #include "linalg/jacobi.hpp"
 #include "linalg/mumps.hpp"
+#include "linalg/schwarz.hpp"
 #include "linalg/strumpack.hpp"
 #include "linalg/superlu.hpp"
 #include "utils/communication.hpp"
@@ -35,6 +38,25 @@ std::unique_ptr<IterativeSolver<OperType>> ConfigureKrylovSolver(MPI_Comm comm,
     case config::LinearSolverData::KspType::CG:
       ksp = std::make_unique<CgSolver<OperType>>(comm, print);
       break;
+    case config::LinearSolverData::KspType::DEFLATEDCG:
+      {
+        auto dcg = std::make_unique<DeflatedCgSolver<OperType>>(comm, print);
+        dcg->SetRecycleDim(iodata.solver.linear.recycle_size);
+        ksp = std::move(dcg);
+      }
+      break;
+    case config::LinearSolverData::KspType::MINRES:
+      ksp = std::make_unique<MinResSolver<OperType>>(comm, print);
+      break;
+    case config::LinearSolverData::KspType::BICGSTAB:
+      ksp = std::make_unique<BiCGStabSolver<OperType>>(comm, print);
+      break;
+    case config::LinearSolverData::KspType::COCG:
+      ksp = std::make_unique<CocgSolver<OperType>>(comm, print);
+      break;
+    case config::LinearSolverData::KspType::COCR:
+      ksp = std::make_unique<CocrSolver<OperType>>(comm, print);
+      break;
     case config::LinearSolverData::KspType::GMRES:
       {
         auto gmres = std::make_unique<GmresSolver<OperType>>(comm, print);
@@ -49,8 +71,29 @@ std::unique_ptr<IterativeSolver<OperType>> ConfigureKrylovSolver(MPI_Comm comm,
         ksp = std::move(fgmres);
       }
       break;
-    case config::LinearSolverData::KspType::MINRES:
-    case config::LinearSolverData::KspType::BICGSTAB:
+    case config::LinearSolverData::KspType::PGMRES:
+      {
+        auto pgmres = std::make_unique<PgmresSolver<OperType>>(comm, print);
+        pgmres->SetRestartDim(iodata.solver.linear.max_size);
+        ksp = std::move(pgmres);
+      }
+      break;
+    case config::LinearSolverData::KspType::SSTEPGMRES:
+      {
+        auto sgmres = std::make_unique<SStepGmresSolver<OperType>>(comm, print);
+        sgmres->SetRestartDim(iodata.solver.linear.max_size);
+        sgmres->SetStepDim(iodata.solver.linear.step_size);
+        ksp = std::move(sgmres);
+      }
+      break;
+    case config::LinearSolverData::KspType::GCRODR:
+      {
+        auto gcrodr = std::make_unique<GcroDrSolver<OperType>>(comm, print);
+        gcrodr->SetRestartDim(iodata.solver.linear.max_size);
+        gcrodr->SetRecycleDim(iodata.solver.linear.recycle_size);
+        ksp = std::move(gcrodr);
+      }
+      break;
     case config::LinearSolverData::KspType::DEFAULT:
       MFEM_ABORT("Unexpected solver type for Krylov solver configuration!");
       break;
@@ -59,9 +102,31 @@ std::unique_ptr<IterativeSolver<OperType>> ConfigureKrylovSolver(MPI_Comm comm,
   ksp->SetRelTol(iodata.solver.linear.tol);
   ksp->SetMaxIter(iodata.solver.linear.max_it);
 
-  // Configure preconditioning side (only for GMRES).
+  // COCG and COCR rely on a complex symmetric preconditioner. The AMS cycle and the
+  // restricted additive Schwarz preconditioner are not symmetric, and neither is the
+  // multigrid F-cycle.
+  if (type == config::LinearSolverData::KspType::COCG ||
+      type == config::LinearSolverData::KspType::COCR)
+  {
+    const auto pc_type = iodata.solver.linear.type;
+    if (pc_type == config::LinearSolverData::Type::AMS ||
+        pc_type == config::LinearSolverData::Type::SCHWARZ ||
+        (iodata.solver.linear.mg_max_levels > 1 &&
+         iodata.solver.linear.mg_cycle_type ==
+             config::LinearSolverData::MultigridCycleType::F))
+    {
+      Mpi::Warning(comm, "COCG and COCR require a complex symmetric preconditioner, "
+                         "convergence may fail with the configured preconditioner or "
+                         "multigrid cycle!\n");
+    }
+  }
+
+  // Configure preconditioning side (only for GMRES, PGMRES, s-step GMRES, and GCRO-DR).
   if (iodata.solver.linear.pc_side_type != config::LinearSolverData::SideType::DEFAULT &&
-      type != config::LinearSolverData::KspType::GMRES)
+      type != config::LinearSolverData::KspType::GMRES &&
+      type != config::LinearSolverData::KspType::PGMRES &&
+      type != config::LinearSolverData::KspType::SSTEPGMRES &&
+      type != config::LinearSolverData::KspType::GCRODR)
   {
     Mpi::Warning(comm,
                  "Preconditioner side will be ignored for non-GMRES iterative solvers!\n");
@@ -69,7 +134,10 @@ std::unique_ptr<IterativeSolver<OperType>> ConfigureKrylovSolver(MPI_Comm comm,
   else
   {
     if (type == config::LinearSolverData::KspType::GMRES ||
-        type == config::LinearSolverData::KspType::FGMRES)
+        type == config::LinearSolverData::KspType::FGMRES ||
+        type == config::LinearSolverData::KspType::PGMRES ||
+        type == config::LinearSolverData::KspType::SSTEPGMRES ||
+        type == config::LinearSolverData::KspType::GCRODR)
     {
       auto *gmres = static_cast<GmresSolver<OperType> *>(ksp.get());
       switch (iodata.solver.linear.pc_side_type)
@@ -87,11 +155,15 @@ std::unique_ptr<IterativeSolver<OperType>> ConfigureKrylovSolver(MPI_Comm comm,
     }
   }
 
-  // Configure orthogonalization method for GMRES/FMGRES.
+  // Configure orthogonalization method for GMRES/FMGRES/s-step GMRES/GCRO-DR. PGMRES always
+  // uses classical Gram-Schmidt, with the reduction overlapped with the operator
+  // application.
   if (type == config::LinearSolverData::KspType::GMRES ||
-      type == config::LinearSolverData::KspType::FGMRES)
+      type == config::LinearSolverData::KspType::FGMRES ||
+      type == config::LinearSolverData::KspType::SSTEPGMRES ||
+      type == config::LinearSolverData::KspType::GCRODR)
   {
-    // Because FGMRES inherits from GMRES, this is OK.
+    // Because FGMRES, s-step GMRES, and GCRO-DR inherit from GMRES, this is OK.
     auto *gmres = static_cast<GmresSolver<OperType> *>(ksp.get());
     switch (iodata.solver.linear.gs_orthog_type)
     {
@@ -113,25 +185,63 @@ std::unique_ptr<IterativeSolver<OperType>> ConfigureKrylovSolver(MPI_Comm comm,
   return ksp;
 }
 
-template <typename OperType, typename T, typename... U>
-auto MakeWrapperSolver(U &&...args)
+template <typename T>
+constexpr bool SaveAssembled()
 {
-  // Sparse direct solver types copy the input matrix, so there is no need to save the
-  // parallel assembled operator.
-  constexpr bool save_assembled = !(false ||
+  // Sparse direct solver types (and the Schwarz preconditioner and agglomerated solvers,
+  // which factor or redistribute their own copies) copy the input matrix, so there is no
+  // need to save the parallel assembled operator.
+  return !(std::is_same<T, SchwarzSolver>::value ||
+           std::is_same<T, AgglomerationSolver>::value ||
 #if defined(MFEM_USE_SUPERLU)
-                                    std::is_same<T, SuperLUSolver>::value ||
+           std::is_same<T, SuperLUSolver>::value ||
 #endif
 #if defined(MFEM_USE_STRUMPACK)
-                                    std::is_same<T, StrumpackSolver>::value ||
-                                    std::is_same<T, StrumpackMixedPrecisionSolver>::value ||
+           std::is_same<T, StrumpackSolver>::value ||
+           std::is_same<T, StrumpackMixedPrecisionSolver>::value ||
 #endif
 #if defined(MFEM_USE_MUMPS)
-                                    std::is_same<T, MumpsSolver>::value ||
+           std::is_same<T, MumpsSolver>::value ||
 #endif
-                                    false);
+           false);
+}
+
+template <typename OperType, typename T, typename... U>
+auto MakeWrapperSolver(U &&...args)
+{
   return std::make_unique<MfemWrapperSolver<OperType>>(
-      std::make_unique<T>(std::forward<U>(args)...), save_assembled);
+      std::make_unique<T>(std::forward<U>(args)...), SaveAssembled<T>());
+}
+
+template <typename OperType, typename T, typename F>
+std::unique_ptr<Solver<OperType>> MakeAgglomeratedWrapperSolver(MPI_Comm comm,
+                                                                int num_procs, int print,
+                                                                F &&make_solver)
+{
+  // Construct the solver on a subset of the processes when the problem is agglomerated,
+  // otherwise construct it on the full communicator.
+  if (num_procs < Mpi::Size(comm))
+  {
+    return MakeWrapperSolver<OperType, AgglomerationSolver>(
+        comm, num_procs, std::forward<F>(make_solver), print);
+  }
+  return std::make_unique<MfemWrapperSolver<OperType>>(make_solver(comm),
+                                                       SaveAssembled<T>());
+}
+
+int GetCoarseAgglomerationSize(MPI_Comm comm, const IoData &iodata,
+                               const FiniteElementSpaceHierarchy &fespaces)
+{
+  // Number of processes for the coarse-level solve of geometric multigrid, based on the
+  // target number of coarse unknowns per process.
+  const int size = Mpi::Size(comm);
+  const HYPRE_BigInt m = iodata.solver.linear.mg_coarse_dofs_per_proc;
+  if (fespaces.GetNumLevels() == 1 || m <= 0)
+  {
+    return size;
+  }
+  const HYPRE_BigInt n = fespaces.GetFESpaceAtLevel(0).GlobalTrueVSize();
+  return static_cast<int>(std::clamp<HYPRE_BigInt>((n + m - 1) / m, 1, size));
 }
 
 template <typename OperType>
@@ -144,6 +254,7 @@ ConfigurePreconditionerSolver(MPI_Comm comm, const IoData &iodata,
   std::unique_ptr<Solver<OperType>> pc;
   const auto type = iodata.solver.linear.type;
   const int print = iodata.problem.verbose - 1;
+  const int agg_procs = GetCoarseAgglomerationSize(comm, iodata, fespaces);
   switch (type)
   {
     case config::LinearSolverData::Type::AMS:
@@ -156,12 +267,18 @@ ConfigurePreconditionerSolver(MPI_Comm comm, const IoData &iodata,
           aux_fespaces->GetFESpaceAtLevel(0), print);
       break;
     case config::LinearSolverData::Type::BOOMER_AMG:
-      pc = MakeWrapperSolver<OperType, BoomerAmgSolver>(iodata, fespaces.GetNumLevels() > 1,
-                                                        print);
+      pc = MakeAgglomeratedWrapperSolver<OperType, BoomerAmgSolver>(
+          comm, agg_procs, print, [&](MPI_Comm)
+          {
+            return std::make_unique<BoomerAmgSolver>(iodata, fespaces.GetNumLevels() > 1,
+                                                     print);
+          });
       break;
     case config::LinearSolverData::Type::SUPERLU:
 #if defined(MFEM_USE_SUPERLU)
-      pc = MakeWrapperSolver<OperType, SuperLUSolver>(comm, iodata, print);
+      pc = MakeAgglomeratedWrapperSolver<OperType, SuperLUSolver>(
+          comm, agg_procs, print, [&](MPI_Comm agg_comm)
+          { return std::make_unique<SuperLUSolver>(agg_comm, iodata, print); });
 #else
       MFEM_ABORT("Solver was not built with SuperLU_DIST support, please choose a "
                  "different solver!");
@@ -169,7 +286,9 @@ ConfigurePreconditionerSolver(MPI_Comm comm, const IoData &iodata,
       break;
     case config::LinearSolverData::Type::STRUMPACK:
 #if defined(MFEM_USE_STRUMPACK)
-      pc = MakeWrapperSolver<OperType, StrumpackSolver>(comm, iodata, print);
+      pc = MakeAgglomeratedWrapperSolver<OperType, StrumpackSolver>(
+          comm, agg_procs, print, [&](MPI_Comm agg_comm)
+          { return std::make_unique<StrumpackSolver>(agg_comm, iodata, print); });
 #else
       MFEM_ABORT("Solver was not built with STRUMPACK support, please choose a "
                  "different solver!");
@@ -177,7 +296,11 @@ ConfigurePreconditionerSolver(MPI_Comm comm, const IoData &iodata,
       break;
     case config::LinearSolverData::Type::STRUMPACK_MP:
 #if defined(MFEM_USE_STRUMPACK)
-      pc = MakeWrapperSolver<OperType, StrumpackMixedPrecisionSolver>(comm, iodata, print);
+      pc = MakeAgglomeratedWrapperSolver<OperType, StrumpackMixedPrecisionSolver>(
+          comm, agg_procs, print, [&](MPI_Comm agg_comm)
+          {
+            return std::make_unique<StrumpackMixedPrecisionSolver>(agg_comm, iodata, print);
+          });
 #else
       MFEM_ABORT("Solver was not built with STRUMPACK support, please choose a "
                  "different solver!");
@@ -185,12 +308,17 @@ ConfigurePreconditionerSolver(MPI_Comm comm, const IoData &iodata,
       break;
     case config::LinearSolverData::Type::MUMPS:
 #if defined(MFEM_USE_MUMPS)
-      pc = MakeWrapperSolver<OperType, MumpsSolver>(comm, iodata, print);
+      pc = MakeAgglomeratedWrapperSolver<OperType, MumpsSolver>(
+          comm, agg_procs, print, [&](MPI_Comm agg_comm)
+          { return std::make_unique<MumpsSolver>(agg_comm, iodata, print); });
 #else
       MFEM_ABORT(
           "Solver was not built with MUMPS support, please choose a different solver!");
 #endif
       break;
+    case config::LinearSolverData::Type::SCHWARZ:
+      pc = MakeWrapperSolver<OperType, SchwarzSolver>(comm, iodata, print);
+      break;
     case config::LinearSolverData::Type::JACOBI:
       pc = std::make_unique<JacobiSmoother<OperType>>(comm);
       break;
@@ -205,10 +333,21 @@ ConfigurePreconditionerSolver(MPI_Comm comm, const IoData &iodata,
     // This will construct the multigrid hierarchy using pc as the coarse solver
     // (ownership of pc is transferred to the GeometricMultigridSolver). When a special
     // auxiliary space smoother for pre-/post-smoothing is not desired, the auxiliary
-    // space is a nullptr here.
+    // space is a nullptr here. Patch smoothers take precedence over auxiliary space
+    // smoothers.
     auto gmg = [&]()
     {
-      if (iodata.solver.linear.mg_smooth_aux)
+      if (iodata.solver.linear.mg_smooth_patch !=
+          config::LinearSolverData::MultigridPatchType::NONE)
+      {
+        const auto patches = fespaces.GetPatchTrueDofs(
+            iodata.solver.linear.mg_smooth_patch ==
+            config::LinearSolverData::MultigridPatchType::VERTEX);
+        return std::make_unique<GeometricMultigridSolver<OperType>>(
+            comm, iodata, std::move(pc), fespaces.GetProlongationOperators(), nullptr,
+            &patches);
+      }
+      else if (iodata.solver.linear.mg_smooth_aux)
       {
         MFEM_VERIFY(aux_fespaces, "Multigrid with auxiliary space smoothers requires both "
                                   "primary space and auxiliary spaces for construction!");
@@ -243,6 +382,10 @@ BaseKspSolver<OperType>::BaseKspSolver(const IoData &iodata,
                                                 iodata, fespaces, aux_fespaces))
 {
   use_timer = true;
+  if (iodata.solver.linear.telemetry)
+  {
+    EnableTelemetry();
+  }
 }
 
 template <typename OperType>
@@ -256,11 +399,45 @@ BaseKspSolver<OperType>::BaseKspSolver(std::unique_ptr<IterativeSolver<OperType>
   }
 }
 
+template <typename OperType>
+void BaseKspSolver<OperType>::SetKspOperator(const OperType &op)
+{
+  if (tel_op)
+  {
+    tel_op->SetOperator(op);
+    ksp->SetOperator(*tel_op);
+  }
+  else
+  {
+    ksp->SetOperator(op);
+  }
+}
+
+template <typename OperType>
+void BaseKspSolver<OperType>::EnableTelemetry()
+{
+  if (telemetry)
+  {
+    return;
+  }
+  telemetry = std::make_unique<SolverTelemetry>();
+  tel_op = std::make_unique<TelemetryOperator<OperType>>(*telemetry,
+                                                         SolverTelemetry::Index::OPERATOR);
+  ksp->SetTelemetry(telemetry.get());
+  if (pc)
+  {
+    tel_pc = std::make_unique<TelemetryOperator<OperType>>(
+        *telemetry, SolverTelemetry::Index::PRECONDITIONER);
+    tel_pc->SetOperator(*pc);
+    ksp->SetPreconditioner(*tel_pc);
+  }
+}
+
 template <typename OperType>
 void BaseKspSolver<OperType>::SetOperators(const OperType &op, const OperType &pc_op)
 {
   BlockTimer bt(Timer::KSP_SETUP, use_timer);
-  ksp->SetOperator(op);
+  SetKspOperator(op);
   if (pc)
   {
     const auto *mg_op = dynamic_cast<const BaseMultigridOperator<OperType> *>(&pc_op);
@@ -276,11 +453,39 @@ void BaseKspSolver<OperType>::SetOperators(const OperType &op, const OperType &p
   }
 }
 
+template <typename OperType>
+void BaseKspSolver<OperType>::SetOperator(const OperType &op)
+{
+  BlockTimer bt(Timer::KSP_SETUP, use_timer);
+  SetKspOperator(op);
+}
+
+template <typename OperType>
+void BaseKspSolver<OperType>::SetQoIFunctionals(const std::vector<VecType> &funcs,
+                                                const std::vector<double> &offsets,
+                                                const std::vector<int> &groups,
+                                                const std::vector<double> &scales,
+                                                double tol)
+{
+  auto *gmres = dynamic_cast<GmresSolver<OperType> *>(ksp.get());
+  MFEM_VERIFY(gmres,
+              "Quantity of interest stopping criterion is only supported for GMRES!");
+  gmres->SetQoIFunctionals(funcs, offsets, groups, scales, tol);
+}
+
 template <typename OperType>
 void BaseKspSolver<OperType>::Mult(const VecType &x, VecType &y) const
 {
   BlockTimer bt(Timer::KSP, use_timer);
+  if (telemetry)
+  {
+    telemetry->BeginSolve();
+  }
   ksp->Mult(x, y);
+  if (telemetry)
+  {
+    telemetry->EndSolve(ksp->GetConverged());
+  }
   if (!ksp->GetConverged())
   {
     Mpi::Warning(
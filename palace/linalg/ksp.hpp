@@ -6,9 +6,11 @@
 
 #include <memory>
 #include <type_traits>
+#include <vector>
 #include "linalg/iterative.hpp"
 #include "linalg/operator.hpp"
 #include "linalg/solver.hpp"
+#include "linalg/telemetry.hpp"
 
 namespace palace
 {
@@ -41,6 +43,14 @@ protected:
   // Enable timer contribution for Timer::KSP_PRECONDITIONER.
   bool use_timer;
 
+  // Optional per-iteration telemetry, with wrappers for the operator and preconditioner
+  // for timing their applications.
+  std::unique_ptr<SolverTelemetry> telemetry;
+  std::unique_ptr<TelemetryOperator<OperType>> tel_op, tel_pc;
+
+  // Set the operator for the iterative solver, through the telemetry wrapper if enabled.
+  void SetKspOperator(const OperType &op);
+
 public:
   BaseKspSolver(const IoData &iodata, FiniteElementSpaceHierarchy &fespaces,
                 FiniteElementSpaceHierarchy *aux_fespaces = nullptr);
@@ -50,8 +60,31 @@ public:
   int NumTotalMult() const { return ksp_mult; }
   int NumTotalMultIterations() const { return ksp_mult_it; }
 
+  // Set whether or not the input solution vector is used as the initial guess for the
+  // iterative solver.
+  void SetInitialGuess(bool guess) { ksp->SetInitialGuess(guess); }
+
+  // Set the relative convergence tolerance for the iterative solver.
+  void SetRelTol(double tol) { ksp->SetRelTol(tol); }
+
+  // Set linear functionals of the solution for an additional stopping criterion based on
+  // the convergence of their values, with constant offsets and normalized within each group
+  // (only supported by GMRES, the functionals must outlive their use).
+  void SetQoIFunctionals(const std::vector<VecType> &funcs,
+                         const std::vector<double> &offsets, const std::vector<int> &groups,
+                         const std::vector<double> &scales, double tol);
+
+  // Enable recording of per-iteration telemetry for all subsequent linear solves (must be
+  // called before setting the operators).
+  void EnableTelemetry();
+  const SolverTelemetry *GetTelemetry() const { return telemetry.get(); }
+
   void SetOperators(const OperType &op, const OperType &pc_op);
 
+  // Update the system operator while reusing the preconditioner constructed for a previous
+  // call to SetOperators (the preconditioner operator must outlive its use).
+  void SetOperator(const OperType &op);
+
   void Mult(const VecType &x, VecType &y) const;
 };
 
@@ -618,27 +618,36 @@ double Norml2(MPI_Comm comm, const ComplexVector &x, const Operator &B, ComplexV
   return std::sqrt(dot.real());
 }
 
-double SpectralNorm(MPI_Comm comm, const Operator &A, bool sym, double tol, int max_it)
+namespace
 {
-  ComplexWrapperOperator Ar(const_cast<Operator *>(&A), nullptr);  // Non-owning constructor
-  return SpectralNorm(comm, Ar, sym, tol, max_it);
+
+inline void MultHermitianTranspose(const Operator &A, const Vector &x, Vector &y)
+{
+  A.MultTranspose(x, y);
 }
 
-double SpectralNorm(MPI_Comm comm, const ComplexOperator &A, bool herm, double tol,
-                    int max_it)
+inline void MultHermitianTranspose(const ComplexOperator &A, const ComplexVector &x,
+                                   ComplexVector &y)
+{
+  A.MultHermitianTranspose(x, y);
+}
+
+template <typename OperType, typename VecType>
+double PowerIteration(MPI_Comm comm, const OperType &A, VecType &u, bool herm, double tol,
+                      int max_it)
 {
-  // XX TODO: Use ARPACK or SLEPc for this when configured.
-#if defined(PALACE_WITH_SLEPC)
-  return slepc::GetMaxSingularValue(comm, A, herm, tol, max_it);
-#else
   // Power iteration loop: ||A||₂² = λₙ(Aᴴ A).
   int it = 0;
   double res = 0.0;
   double l = 0.0, l0 = 0.0;
-  ComplexVector u(A.Height()), v(A.Height());
-  u.UseDevice(true);
+  VecType v(A.Height());
   v.UseDevice(true);
-  SetRandom(comm, u);
+  if (u.Size() != A.Height())
+  {
+    u.SetSize(A.Height());
+    u.UseDevice(true);
+    SetRandom(comm, u);
+  }
   Normalize(comm, u);
   while (it < max_it)
   {
@@ -649,7 +658,7 @@ double SpectralNorm(MPI_Comm comm, const ComplexOperator &A, bool herm, double t
     }
     else
     {
-      A.MultHermitianTranspose(v, u);
+      MultHermitianTranspose(A, v, u);
     }
     l = Normalize(comm, u);
     if (it > 0)
@@ -671,9 +680,40 @@ double SpectralNorm(MPI_Comm comm, const ComplexOperator &A, bool herm, double t
                  it, res, l);
   }
   return herm ? l : std::sqrt(l);
+}
+
+}  // namespace
+
+double SpectralNorm(MPI_Comm comm, const Operator &A, bool sym, double tol, int max_it)
+{
+  ComplexWrapperOperator Ar(const_cast<Operator *>(&A), nullptr);  // Non-owning constructor
+  return SpectralNorm(comm, Ar, sym, tol, max_it);
+}
+
+double SpectralNorm(MPI_Comm comm, const ComplexOperator &A, bool herm, double tol,
+                    int max_it)
+{
+  // XX TODO: Use ARPACK or SLEPc for this when configured.
+#if defined(PALACE_WITH_SLEPC)
+  return slepc::GetMaxSingularValue(comm, A, herm, tol, max_it);
+#else
+  ComplexVector u;
+  return PowerIteration(comm, A, u, herm, tol, max_it);
 #endif
 }
 
+double SpectralNorm(MPI_Comm comm, const Operator &A, Vector &u, bool sym, double tol,
+                    int max_it)
+{
+  return PowerIteration(comm, A, u, sym, tol, max_it);
+}
+
+double SpectralNorm(MPI_Comm comm, const ComplexOperator &A, ComplexVector &u, bool herm,
+                    double tol, int max_it)
+{
+  return PowerIteration(comm, A, u, herm, tol, max_it);
+}
+
 }  // namespace linalg
 
 }  // namespace palace
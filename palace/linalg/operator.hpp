@@ -390,6 +390,15 @@ double SpectralNorm(MPI_Comm comm, const Operator &A, bool sym = false, double t
 double SpectralNorm(MPI_Comm comm, const ComplexOperator &A, bool herm = false,
                     double tol = 1.0e-4, int max_it = 1000);
 
+// Estimate operator 2-norm using power iteration, starting from the given vector when it
+// has the correct size (otherwise from a random vector). On return, the vector holds the
+// approximate dominant right singular vector, which can be used to warm start the estimate
+// for a subsequent, nearby operator.
+double SpectralNorm(MPI_Comm comm, const Operator &A, Vector &u, bool sym = false,
+                    double tol = 1.0e-4, int max_it = 1000);
+double SpectralNorm(MPI_Comm comm, const ComplexOperator &A, ComplexVector &u,
+                    bool herm = false, double tol = 1.0e-4, int max_it = 1000);
+
 }  // namespace linalg
 
 }  // namespace palace
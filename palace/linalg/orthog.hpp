@@ -39,27 +39,16 @@ inline void OrthogonalizeColumnCGS(MPI_Comm comm, const std::vector<VecType> &V,
   {
     return;
   }
-  for (int j = 0; j < m; j++)
-  {
-    H[j] = w * V[j];  // Local inner product
-  }
-  Mpi::GlobalSum(m, H, comm);
-  for (int j = 0; j < m; j++)
-  {
-    w.Add(-H[j], V[j]);
-  }
+  linalg::MDot(comm, w, V.data(), m, H);
+  linalg::MAXPY(m, H, V.data(), w, -1.0);
   if (refine)
   {
     std::vector<ScalarType> dH(m);
-    for (int j = 0; j < m; j++)
-    {
-      dH[j] = w * V[j];  // Local inner product
-    }
-    Mpi::GlobalSum(m, dH.data(), comm);
+    linalg::MDot(comm, w, V.data(), m, dH.data());
+    linalg::MAXPY(m, dH.data(), V.data(), w, -1.0);
     for (int j = 0; j < m; j++)
     {
       H[j] += dH[j];
-      w.Add(-dH[j], V[j]);
     }
   }
 }
@@ -0,0 +1,303 @@
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#include "patch.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <tuple>
+#include <mfem.hpp>
+#include "linalg/rap.hpp"
+
+namespace palace
+{
+
+// The undamped patch correction operator (complex symmetric, but not Hermitian, for
+// complex-valued operators).
+template <>
+class PatchSmoother<Operator>::PatchOperator : public Operator
+{
+private:
+  const PatchSmoother<Operator> &smoother;
+
+public:
+  PatchOperator(const PatchSmoother<Operator> &smoother)
+    : Operator(smoother.Height(), smoother.Width()), smoother(smoother)
+  {
+  }
+
+  void Mult(const Vector &x, Vector &y) const override
+  {
+    y = 0.0;
+    smoother.ApplyPatches(x, y, 1.0);
+  }
+
+  void MultTranspose(const Vector &x, Vector &y) const override { Mult(x, y); }
+};
+
+template <>
+class PatchSmoother<ComplexOperator>::PatchOperator : public ComplexOperator
+{
+private:
+  const PatchSmoother<ComplexOperator> &smoother;
+
+public:
+  PatchOperator(const PatchSmoother<ComplexOperator> &smoother)
+    : ComplexOperator(smoother.Height(), smoother.Width()), smoother(smoother)
+  {
+  }
+
+  void Mult(const ComplexVector &x, ComplexVector &y) const override
+  {
+    y = 0.0;
+    smoother.ApplyPatches(x, y, 1.0);
+  }
+
+  void MultTranspose(const ComplexVector &x, ComplexVector &y) const override
+  {
+    Mult(x, y);
+  }
+
+  void MultHermitianTranspose(const ComplexVector &x, ComplexVector &y) const override
+  {
+    y = 0.0;
+    smoother.ApplyPatches(x, y, 1.0, true);
+  }
+};
+
+template <typename OperType>
+PatchSmoother<OperType>::PatchSmoother(MPI_Comm comm,
+                                       const std::vector<std::vector<int>> &patches,
+                                       int smooth_it)
+  : Solver<OperType>(), comm(comm), pc_it(smooth_it), A(nullptr), omega(0.0)
+{
+  patch_ptr.reserve(patches.size() + 1);
+  patch_ptr.push_back(0);
+  for (const auto &patch : patches)
+  {
+    patch_dofs.insert(patch_dofs.end(), patch.begin(), patch.end());
+    patch_ptr.push_back(static_cast<int>(patch_dofs.size()));
+  }
+}
+
+template <typename OperType>
+void PatchSmoother<OperType>::SetOperator(const OperType &op)
+{
+  // Assemble the operator to extract the patch matrices, then release the assembled
+  // matrix. The operator itself is still applied matrix-free. This is only called when the
+  // preconditioner is rebuilt, so a reused preconditioner does not assemble again.
+  A = &op;
+  if constexpr (std::is_same<OperType, ComplexOperator>::value)
+  {
+    const auto *PtAPr = dynamic_cast<const ParOperator *>(op.Real());
+    const auto *PtAPi = dynamic_cast<const ParOperator *>(op.Imag());
+    MFEM_VERIFY(PtAPr && (PtAPi || !op.Imag()),
+                "PatchSmoother requires a ComplexParOperator with a nonzero real part!");
+    auto hAr = PtAPr->StealParallelAssemble();
+    auto hAi = PtAPi ? PtAPi->StealParallelAssemble() : nullptr;
+    mfem::SparseMatrix diag_r, diag_i;
+    hAr->HostRead();
+    hAr->GetDiag(diag_r);
+    if (hAi)
+    {
+      hAi->HostRead();
+      hAi->GetDiag(diag_i);
+    }
+    Factor(diag_r, hAi ? &diag_i : nullptr);
+  }
+  else
+  {
+    const auto *PtAP = dynamic_cast<const ParOperator *>(&op);
+    MFEM_VERIFY(PtAP, "PatchSmoother requires a ParOperator operator!");
+    auto hA = PtAP->StealParallelAssemble();
+    mfem::SparseMatrix diag;
+    hA->HostRead();
+    hA->GetDiag(diag);
+    Factor(diag, nullptr);
+  }
+
+  // The weights are the inverse square root of the number of patches containing each
+  // unknown.
+  w.SetSize(op.Height());
+  w.UseDevice(true);
+  {
+    auto *W = w.HostWrite();
+    std::fill(W, W + w.Size(), 0.0);
+    for (const auto dof : patch_dofs)
+    {
+      W[dof] += 1.0;
+    }
+    for (int i = 0; i < w.Size(); i++)
+    {
+      W[i] = (W[i] > 0.0) ? 1.0 / std::sqrt(W[i]) : 0.0;
+    }
+  }
+
+  this->height = op.Height();
+  this->width = op.Width();
+
+  // Damp the patch corrections by the maximum eigenvalue of B A, which grows with the
+  // patch overlap. The power iteration is warm started from the previous dominant
+  // eigenvector.
+  PatchOperator B(*this);
+  BaseProductOperator<OperType> BA(B, op);
+  double lambda_max;
+  if constexpr (std::is_same<OperType, ComplexOperator>::value)
+  {
+    lambda_max = linalg::SpectralNorm(comm, BA, u_max, op.IsReal());
+  }
+  else
+  {
+    lambda_max = linalg::SpectralNorm(comm, BA, u_max, true);
+  }
+  MFEM_VERIFY(lambda_max > 0.0, "Encountered zero maximum eigenvalue in patch smoother!");
+  omega = 1.0 / lambda_max;
+}
+
+template <typename OperType>
+void PatchSmoother<OperType>::Factor(const mfem::SparseMatrix &Ar,
+                                     const mfem::SparseMatrix *Ai)
+{
+  // Extract each patch matrix and compute its LU factorization, in complex arithmetic for
+  // complex-valued operators.
+  const int num_patches = static_cast<int>(patch_ptr.size()) - 1;
+  int max_size = 0;
+  lu.clear();
+  lu.reserve(num_patches);
+  std::vector<int> marker(Ar.Width(), -1);
+  MatType Ap;
+  for (int p = 0; p < num_patches; p++)
+  {
+    const int *dofs = patch_dofs.data() + patch_ptr[p];
+    const int n = patch_ptr[p + 1] - patch_ptr[p];
+    for (int i = 0; i < n; i++)
+    {
+      marker[dofs[i]] = i;
+    }
+    Ap.setZero(n, n);
+    for (int i = 0; i < n; i++)
+    {
+      const int row = dofs[i];
+      for (int k = Ar.GetI()[row]; k < Ar.GetI()[row + 1]; k++)
+      {
+        const int j = marker[Ar.GetJ()[k]];
+        if (j >= 0)
+        {
+          Ap(i, j) = Ar.GetData()[k];
+        }
+      }
+      if constexpr (std::is_same<OperType, ComplexOperator>::value)
+      {
+        if (Ai)
+        {
+          for (int k = Ai->GetI()[row]; k < Ai->GetI()[row + 1]; k++)
+          {
+            const int j = marker[Ai->GetJ()[k]];
+            if (j >= 0)
+            {
+              Ap(i, j) += ScalarType(0.0, Ai->GetData()[k]);
+            }
+          }
+        }
+      }
+    }
+    lu.emplace_back(Ap);
+    max_size = std::max(max_size, n);
+    for (int i = 0; i < n; i++)
+    {
+      marker[dofs[i]] = -1;
+    }
+  }
+  rp.resize(max_size);
+  yp.resize(max_size);
+}
+
+namespace
+{
+
+inline auto GetHostPointers(const Vector &r, Vector &y)
+{
+  return std::make_tuple(r.HostRead(), static_cast<const double *>(nullptr),
+                         y.HostReadWrite(), static_cast<double *>(nullptr));
+}
+
+inline auto GetHostPointers(const ComplexVector &r, ComplexVector &y)
+{
+  return std::make_tuple(r.Real().HostRead(), r.Imag().HostRead(), y.Real().HostReadWrite(),
+                         y.Imag().HostReadWrite());
+}
+
+}  // namespace
+
+template <typename OperType>
+void PatchSmoother<OperType>::ApplyPatches(const VecType &r, VecType &y, double a,
+                                           bool adjoint) const
+{
+  // The patch solves are performed on the host.
+  constexpr bool complex = std::is_same<OperType, ComplexOperator>::value;
+  const auto [RR, RI, YR, YI] = GetHostPointers(r, y);
+  const auto *W = w.HostRead();
+  const int num_patches = static_cast<int>(patch_ptr.size()) - 1;
+  for (int p = 0; p < num_patches; p++)
+  {
+    const int *dofs = patch_dofs.data() + patch_ptr[p];
+    const int n = patch_ptr[p + 1] - patch_ptr[p];
+    for (int i = 0; i < n; i++)
+    {
+      if constexpr (complex)
+      {
+        rp(i) = W[dofs[i]] * ScalarType(RR[dofs[i]], RI[dofs[i]]);
+      }
+      else
+      {
+        rp(i) = W[dofs[i]] * RR[dofs[i]];
+      }
+    }
+    if (adjoint)
+    {
+      yp.head(n) = lu[p].adjoint().solve(rp.head(n));
+    }
+    else
+    {
+      yp.head(n) = lu[p].solve(rp.head(n));
+    }
+    for (int i = 0; i < n; i++)
+    {
+      if constexpr (complex)
+      {
+        YR[dofs[i]] += a * W[dofs[i]] * yp(i).real();
+        YI[dofs[i]] += a * W[dofs[i]] * yp(i).imag();
+      }
+      else
+      {
+        YR[dofs[i]] += a * W[dofs[i]] * yp(i);
+      }
+    }
+  }
+}
+
+template <typename OperType>
+void PatchSmoother<OperType>::Mult2(const VecType &x, VecType &y, VecType &r) const
+{
+  // Apply smoother: y = y + ω B (x - A y) .
+  for (int it = 0; it < pc_it; it++)
+  {
+    if (this->initial_guess || it > 0)
+    {
+      A->Mult(y, r);
+      linalg::AXPBY(1.0, x, -1.0, r);
+    }
+    else
+    {
+      r = x;
+      y = 0.0;
+    }
+    ApplyPatches(r, y, omega);
+  }
+}
+
+template class PatchSmoother<Operator>;
+template class PatchSmoother<ComplexOperator>;
+
+}  // namespace palace
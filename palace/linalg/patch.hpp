@@ -0,0 +1,113 @@
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef PALACE_LINALG_PATCH_SMOOTHER_HPP
+#define PALACE_LINALG_PATCH_SMOOTHER_HPP
+
+#include <complex>
+#include <type_traits>
+#include <vector>
+#include <Eigen/Dense>
+#include "linalg/operator.hpp"
+#include "linalg/solver.hpp"
+#include "linalg/vector.hpp"
+
+namespace palace
+{
+
+//
+// Overlapping additive Schwarz smoother with small patches of unknowns (for example the
+// closure of each element or the star of each vertex), where each patch problem is solved
+// exactly with a dense LU factorization of the patch matrix. The patch corrections are
+// weighted by the inverse square root of the multiplicity of each unknown on both sides to
+// keep the smoother symmetric. The smoother is applied as a Richardson iteration damped by
+// an estimate of the maximum eigenvalue of the preconditioned operator, since for
+// overlapping patches this is not bounded by one. Unlike pointwise smoothers, vertex-star
+// patch smoothers are robust with respect to the polynomial order for H(curl) problems.
+// Reference: Arnold, Falk, and Winther, Multigrid in H(div) and H(curl), Numer. Math.
+//            (2000).
+//
+template <typename OperType>
+class PatchSmoother : public Solver<OperType>
+{
+  using VecType = typename Solver<OperType>::VecType;
+  using ScalarType =
+      typename std::conditional<std::is_same<OperType, ComplexOperator>::value,
+                                std::complex<double>, double>::type;
+  using MatType = Eigen::Matrix<ScalarType, Eigen::Dynamic, Eigen::Dynamic>;
+  using EigenVecType = Eigen::Matrix<ScalarType, Eigen::Dynamic, 1>;
+
+  // Operator for the undamped patch correction, used for the eigenvalue estimate.
+  class PatchOperator;
+
+private:
+  MPI_Comm comm;
+
+  // Number of smoother iterations.
+  const int pc_it;
+
+  // System matrix (not owned).
+  const OperType *A;
+
+  // Local true dofs for each patch in CSR format.
+  std::vector<int> patch_ptr, patch_dofs;
+
+  // LU factorizations of the patch matrices.
+  std::vector<Eigen::PartialPivLU<MatType>> lu;
+
+  // Partition of unity weights for the patch corrections.
+  Vector w;
+
+  // Damping factor for the patch corrections (inverse of the maximum eigenvalue estimate),
+  // and the dominant eigenvector estimate used to warm start the next estimate.
+  double omega;
+  VecType u_max;
+
+  // Temporary vectors for smoother application.
+  mutable VecType r;
+  mutable EigenVecType rp, yp;
+
+  // Extract and factor the patch matrices from the local diagonal blocks of the assembled
+  // operator (imaginary part may be nullptr).
+  void Factor(const mfem::SparseMatrix &Ar, const mfem::SparseMatrix *Ai);
+
+  // Add the (weighted) patch corrections for the residual r to y, y += a B r, or the
+  // corrections with the adjoint patch solves.
+  void ApplyPatches(const VecType &r, VecType &y, double a, bool adjoint = false) const;
+
+public:
+  PatchSmoother(MPI_Comm comm, const std::vector<std::vector<int>> &patches, int smooth_it);
+
+  void SetOperator(const OperType &op) override;
+
+  void Mult(const VecType &x, VecType &y) const override
+  {
+    if (r.Size() != y.Size())
+    {
+      r.SetSize(y.Size());
+      r.UseDevice(true);
+    }
+    Mult2(x, y, r);
+  }
+
+  void MultTranspose(const VecType &x, VecType &y) const override
+  {
+    if (r.Size() != y.Size())
+    {
+      r.SetSize(y.Size());
+      r.UseDevice(true);
+    }
+    MultTranspose2(x, y, r);
+  }
+
+  void Mult2(const VecType &x, VecType &y, VecType &r) const override;
+
+  void MultTranspose2(const VecType &x, VecType &y, VecType &r) const override
+  {
+    Mult2(x, y, r);  // Assumes operator symmetry
+  }
+};
+
+}  // namespace palace
+
+#endif  // PALACE_LINALG_PATCH_SMOOTHER_HPP
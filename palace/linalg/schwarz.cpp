@@ -0,0 +1,166 @@
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#include "schwarz.hpp"
+
+#include "linalg/mumps.hpp"
+#include "linalg/strumpack.hpp"
+#include "linalg/superlu.hpp"
+#include "utils/communication.hpp"
+#include "utils/iodata.hpp"
+
+namespace palace
+{
+
+namespace
+{
+
+std::unique_ptr<mfem::Solver> ConfigureSubdomainSolver(const IoData &iodata)
+{
+  // The subdomain problems are local to each process, so use the same sparse direct solver
+  // as for the default preconditioner type but on MPI_COMM_SELF.
+#if defined(MFEM_USE_SUPERLU)
+  return std::make_unique<SuperLUSolver>(MPI_COMM_SELF, iodata, 0);
+#elif defined(MFEM_USE_STRUMPACK)
+  return std::make_unique<StrumpackSolver>(MPI_COMM_SELF, iodata, 0);
+#elif defined(MFEM_USE_MUMPS)
+  return std::make_unique<MumpsSolver>(MPI_COMM_SELF, iodata, 0);
+#else
+  MFEM_ABORT("Schwarz preconditioner requires building with SuperLU_DIST, STRUMPACK, or "
+             "MUMPS for the subdomain solves!");
+  return {};
+#endif
+}
+
+// Construct the restriction from the global unknowns of the square matrix A to the
+// subdomain given by the list of global indices, with a single unit entry per row.
+std::unique_ptr<mfem::HypreParMatrix>
+GetRestriction(MPI_Comm comm, const mfem::HypreParMatrix &A,
+               const std::vector<HYPRE_BigInt> &dofs)
+{
+  const int n = static_cast<int>(dofs.size());
+  HYPRE_BigInt loc_n = n, glob_n = n, rows[2];
+  MPI_Scan(&loc_n, &rows[1], 1, mpi::DataType<HYPRE_BigInt>(), MPI_SUM, comm);
+  rows[0] = rows[1] - loc_n;
+  Mpi::GlobalSum(1, &glob_n, comm);
+  mfem::Array<int> I(n + 1);
+  mfem::Array<HYPRE_BigInt> J(n);
+  mfem::Vector data(n);
+  for (int i = 0; i < n; i++)
+  {
+    I[i] = i;
+    J[i] = dofs[i];
+  }
+  I[n] = n;
+  data = 1.0;
+  HYPRE_BigInt cols[2] = {A.GetColStarts()[0], A.GetColStarts()[1]};
+  return std::make_unique<mfem::HypreParMatrix>(comm, n, glob_n, A.GetGlobalNumCols(),
+                                                I.GetData(), J.GetData(), data.GetData(),
+                                                rows, cols);
+}
+
+}  // namespace
+
+SchwarzSolver::SchwarzSolver(MPI_Comm comm, std::unique_ptr<mfem::Solver> &&solver,
+                             int overlap, int print)
+  : mfem::Solver(), comm(comm), overlap(overlap), solver(std::move(solver)), print(print)
+{
+  MFEM_VERIFY(overlap >= 0, "Schwarz preconditioner overlap must be nonnegative!");
+}
+
+SchwarzSolver::SchwarzSolver(MPI_Comm comm, const IoData &iodata, int print)
+  : SchwarzSolver(comm, ConfigureSubdomainSolver(iodata),
+                  iodata.solver.linear.schwarz_overlap, print)
+{
+}
+
+void SchwarzSolver::SetOperator(const Operator &op)
+{
+  const auto *A = dynamic_cast<const mfem::HypreParMatrix *>(&op);
+  MFEM_VERIFY(A && A->GetGlobalNumRows() == A->GetGlobalNumCols(),
+              "SchwarzSolver requires a square HypreParMatrix operator!");
+  height = A->Height();
+  width = A->Width();
+
+  // Construct the subdomain starting from the locally owned unknowns, adding one layer of
+  // neighboring unknowns at a time. The off-diagonal column map of the rows of A restricted
+  // to the current subdomain gives exactly the unknowns in the next layer which are not
+  // owned, in sorted order.
+  const HYPRE_BigInt row_start = A->GetRowStarts()[0];
+  std::vector<HYPRE_BigInt> dofs(height);
+  for (int i = 0; i < height; i++)
+  {
+    dofs[i] = row_start + i;
+  }
+  for (int k = 0; k < overlap; k++)
+  {
+    std::unique_ptr<mfem::HypreParMatrix> RA;
+    if (k > 0)
+    {
+      RA.reset(mfem::ParMult(GetRestriction(comm, *A, dofs).get(), A));
+    }
+    const mfem::HypreParMatrix &B = RA ? *RA : *A;
+    mfem::SparseMatrix offd;
+    HYPRE_BigInt *cmap;
+    B.HostRead();
+    B.GetOffd(offd, cmap);
+    dofs.resize(height);
+    dofs.insert(dofs.end(), cmap, cmap + offd.Width());
+  }
+
+  // The subdomain matrix is the local diagonal block of R A Rᵀ, which is factored by the
+  // local sparse direct solver.
+  R = GetRestriction(comm, *A, dofs);
+  {
+    std::unique_ptr<mfem::HypreParMatrix> RT(R->Transpose());
+    std::unique_ptr<mfem::HypreParMatrix> A_ov(mfem::RAP(A, RT.get()));
+    mfem::SparseMatrix diag;
+    A_ov->HostRead();
+    A_ov->GetDiag(diag);
+    HYPRE_BigInt loc_starts[2] = {0, diag.Height()};
+    mfem::HypreParMatrix A_loc(MPI_COMM_SELF, diag.Height(), loc_starts, &diag);
+    solver->SetOperator(A_loc);
+  }
+
+  if (print > 0)
+  {
+    HYPRE_BigInt n_min = static_cast<HYPRE_BigInt>(dofs.size()), n_max = n_min;
+    Mpi::GlobalMinMax(1, &n_min, &n_max, comm);
+    Mpi::Print(comm,
+               " Schwarz preconditioner: overlap = {:d}, subdomain size = {:d}-{:d}\n",
+               overlap, n_min, n_max);
+  }
+}
+
+void SchwarzSolver::ArrayMult(const mfem::Array<const Vector *> &X,
+                              mfem::Array<Vector *> &Y) const
+{
+  // Restrict the global vectors to the subdomain, solve the local problems, and keep only
+  // the solution for the locally owned unknowns (restricted additive Schwarz).
+  const int n = X.Size();
+  if (static_cast<int>(xr.size()) < n)
+  {
+    xr.resize(n);
+    yr.resize(n);
+  }
+  mfem::Array<const Vector *> XR(n);
+  mfem::Array<Vector *> YR(n);
+  for (int j = 0; j < n; j++)
+  {
+    xr[j].SetSize(R->Height());
+    yr[j].SetSize(R->Height());
+    xr[j].UseDevice(true);
+    yr[j].UseDevice(true);
+    R->Mult(*X[j], xr[j]);
+    XR[j] = &xr[j];
+    YR[j] = &yr[j];
+  }
+  solver->ArrayMult(XR, YR);
+  for (int j = 0; j < n; j++)
+  {
+    Vector yr_own(yr[j], 0, height);
+    *Y[j] = yr_own;
+  }
+}
+
+}  // namespace palace
@@ -0,0 +1,68 @@
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef PALACE_LINALG_SCHWARZ_HPP
+#define PALACE_LINALG_SCHWARZ_HPP
+
+#include <memory>
+#include <vector>
+#include <mfem.hpp>
+#include "linalg/operator.hpp"
+#include "linalg/vector.hpp"
+
+namespace palace
+{
+
+class IoData;
+
+//
+// Restricted additive Schwarz (RAS) preconditioner with algebraic overlap. Each process
+// owns one subdomain made up of its locally owned unknowns, extended by a given number of
+// layers of neighboring unknowns through the graph of the parallel assembled matrix. The
+// subdomain problems are solved with a sparse direct solver on each process, and only the
+// subdomain solution for the locally owned unknowns is kept, so the preconditioner
+// application requires a single neighbor exchange.
+//
+class SchwarzSolver : public mfem::Solver
+{
+private:
+  MPI_Comm comm;
+
+  // Number of layers of overlap for the subdomains (0 for block Jacobi).
+  int overlap;
+
+  // Restriction from the global unknowns to the overlapping subdomain, with the locally
+  // owned unknowns ordered first.
+  std::unique_ptr<mfem::HypreParMatrix> R;
+
+  // Sparse direct solver for the local subdomain problem.
+  std::unique_ptr<mfem::Solver> solver;
+
+  // Temporary vectors for the subdomain problems.
+  mutable std::vector<Vector> xr, yr;
+
+  int print;
+
+public:
+  SchwarzSolver(MPI_Comm comm, std::unique_ptr<mfem::Solver> &&solver, int overlap,
+                int print);
+  SchwarzSolver(MPI_Comm comm, const IoData &iodata, int print);
+
+  void SetOperator(const Operator &op) override;
+
+  void Mult(const Vector &x, Vector &y) const override
+  {
+    mfem::Array<const Vector *> X(1);
+    mfem::Array<Vector *> Y(1);
+    X[0] = &x;
+    Y[0] = &y;
+    ArrayMult(X, Y);
+  }
+
+  void ArrayMult(const mfem::Array<const Vector *> &X,
+                 mfem::Array<Vector *> &Y) const override;
+};
+
+}  // namespace palace
+
+#endif  // PALACE_LINALG_SCHWARZ_HPP
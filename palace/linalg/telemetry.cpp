@@ -0,0 +1,46 @@
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#include "telemetry.hpp"
+
+#include <algorithm>
+#include "utils/communication.hpp"
+
+namespace palace
+{
+
+void SolverTelemetry::BeginSolve()
+{
+  solves.push_back({adapt_it, tag, tag_value, false, {}});
+  t_op = t_pc = 0.0;
+  t_start = Timer::Now();
+  n_red_start = Mpi::NumGlobalReductions();
+  active = true;
+}
+
+void SolverTelemetry::EndSolve(bool converged)
+{
+  MFEM_VERIFY(active && !solves.empty(),
+              "SolverTelemetry::EndSolve called without matching BeginSolve!");
+  solves.back().converged = converged;
+  active = false;
+}
+
+void SolverTelemetry::RecordIteration(int it, double res)
+{
+  if (!active)
+  {
+    return;
+  }
+  const auto t_end = Timer::Now();
+  const std::size_t n_red_end = Mpi::NumGlobalReductions();
+  const double t_tot = Timer::Duration(t_end - t_start).count();
+  solves.back().iterations.push_back({it, res, t_op, t_pc,
+                                      std::max(t_tot - t_op - t_pc, 0.0),
+                                      static_cast<int>(n_red_end - n_red_start)});
+  t_op = t_pc = 0.0;
+  t_start = t_end;
+  n_red_start = n_red_end;
+}
+
+}  // namespace palace
@@ -0,0 +1,147 @@
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef PALACE_LINALG_TELEMETRY_HPP
+#define PALACE_LINALG_TELEMETRY_HPP
+
+#include <string>
+#include <type_traits>
+#include <vector>
+#include "linalg/operator.hpp"
+#include "linalg/solver.hpp"
+#include "linalg/vector.hpp"
+#include "utils/timer.hpp"
+
+namespace palace
+{
+
+//
+// Class for recording per-iteration statistics of iterative linear solves: the residual
+// norm history, and the time spent in the operator, the preconditioner, and the remaining
+// Krylov method work (orthogonalization, vector updates, and global reductions), as well as
+// the number of global reductions issued by Palace's Krylov solvers (not including those
+// inside the preconditioner or external libraries), for each iteration. Timings are
+// measured locally on each process.
+//
+class SolverTelemetry
+{
+public:
+  enum class Index
+  {
+    OPERATOR,
+    PRECONDITIONER
+  };
+
+  struct IterationData
+  {
+    int it;         // Iteration number
+    double res;     // Residual norm
+    double t_op;    // Time for operator applications
+    double t_pc;    // Time for preconditioner applications
+    double t_orth;  // Remaining time for orthogonalization and vector updates
+    int n_red;      // Number of global reductions issued by the Krylov solver
+  };
+
+  struct SolveData
+  {
+    int adapt_it;        // AMR iteration
+    std::string tag;     // Name of the tag value identifying the solve (may be empty)
+    double tag_value;    // Frequency, time, terminal index, etc.
+    bool converged;      // Whether or not the solve converged
+    std::vector<IterationData> iterations;
+  };
+
+private:
+  // Recorded data for all solves.
+  std::vector<SolveData> solves;
+
+  // Accumulated operator and preconditioner time, start time, and number of global
+  // reductions at the start of the current iteration.
+  double t_op, t_pc;
+  Timer::TimePoint t_start;
+  std::size_t n_red_start;
+  bool active;
+
+  // Tag and AMR iteration identifying the current solves, set by the simulation drivers.
+  inline static std::string tag;
+  inline static double tag_value = 0.0;
+  inline static int adapt_it = 0;
+
+public:
+  SolverTelemetry() : t_op(0.0), t_pc(0.0), n_red_start(0), active(false) {}
+
+  // Set the tag (for example, the frequency or time) for the following linear solves.
+  static void SetTag(const std::string &name, double value)
+  {
+    tag = name;
+    tag_value = value;
+  }
+  static void ClearTag() { tag.clear(); }
+
+  // Set the AMR iteration for the following linear solves.
+  static void SetAdaptIteration(int it) { adapt_it = it; }
+  static int GetAdaptIteration() { return adapt_it; }
+
+  // Mark the beginning and end of a linear solve.
+  void BeginSolve();
+  void EndSolve(bool converged);
+
+  // Add time spent in an operator or preconditioner application to the current iteration.
+  void AddTime(Index idx, Timer::Duration time)
+  {
+    if (active)
+    {
+      (idx == Index::OPERATOR ? t_op : t_pc) += time.count();
+    }
+  }
+
+  // Record the residual norm at the end of an iteration (or at the start of the solve for
+  // it = 0), along with the timings and reduction count since the previous record.
+  void RecordIteration(int it, double res);
+
+  // Access the recorded data.
+  const auto &GetSolves() const { return solves; }
+  void Clear() { solves.clear(); }
+};
+
+//
+// Wrapper for an operator or preconditioner passed to an iterative solver, which records
+// the time spent in its applications in the solver telemetry.
+//
+template <typename OperType>
+class TelemetryOperator : public Solver<OperType>
+{
+  using VecType = typename Solver<OperType>::VecType;
+
+private:
+  // The wrapped operator or preconditioner (not owned).
+  const OperType *op;
+
+  // Telemetry recording the timings.
+  SolverTelemetry &telemetry;
+  const SolverTelemetry::Index idx;
+
+public:
+  TelemetryOperator(SolverTelemetry &telemetry, SolverTelemetry::Index idx)
+    : Solver<OperType>(), op(nullptr), telemetry(telemetry), idx(idx)
+  {
+  }
+
+  void SetOperator(const OperType &op_) override
+  {
+    op = &op_;
+    this->height = op_.Height();
+    this->width = op_.Width();
+  }
+
+  void Mult(const VecType &x, VecType &y) const override
+  {
+    const auto t0 = Timer::Now();
+    op->Mult(x, y);
+    telemetry.AddTime(idx, Timer::Now() - t0);
+  }
+};
+
+}  // namespace palace
+
+#endif  // PALACE_LINALG_TELEMETRY_HPP
@@ -3,6 +3,7 @@
 
 #include "vector.hpp"
 
+#include <algorithm>
 #include <cstdint>
 #include <random>
 #include <mfem/general/forall.hpp>
@@ -649,6 +650,143 @@ std::complex<double> LocalDot(const ComplexVector &x, const ComplexVector &y)
   }
 }
 
+namespace
+{
+
+// The fused multi-vector kernels process rows in blocks small enough for the block of x
+// (or y) to remain in cache while the n basis vectors are streamed through. The basis
+// vectors are accessed through host pointers, so for GPU devices these kernels fall back
+// to one kernel launch per vector.
+constexpr int mvec_block_size = 1024;
+
+inline bool UseMultiVectorKernels()
+{
+  return !mfem::Device::Allows(mfem::Backend::DEVICE_MASK);
+}
+
+}  // namespace
+
+void LocalMDot(const Vector &x, const Vector *y, int n, double *dot)
+{
+  if (n == 0)
+  {
+    return;
+  }
+  if (!UseMultiVectorKernels())
+  {
+    for (int j = 0; j < n; j++)
+    {
+      dot[j] = LocalDot(x, y[j]);
+    }
+    return;
+  }
+  const int N = x.Size();
+  const auto *X = x.HostRead();
+  std::vector<const double *> Y(n);
+  for (int j = 0; j < n; j++)
+  {
+    MFEM_ASSERT(y[j].Size() == N, "Size mismatch for vector inner product!");
+    Y[j] = y[j].HostRead();
+  }
+
+  // Each thread accumulates partial sums over its row blocks, which are summed in thread
+  // order afterwards for a reproducible result.
+  const int num_blocks = (N + mvec_block_size - 1) / mvec_block_size;
+  const int nt = (num_blocks > 1) ? utils::GetMaxThreads() : 1;
+  std::vector<double> partial(static_cast<std::size_t>(nt) * n, 0.0);
+  PalacePragmaOmp(parallel if (nt > 1))
+  {
+    double *loc = partial.data() + static_cast<std::size_t>(utils::GetThreadNum()) * n;
+    PalacePragmaOmp(for schedule(static))
+    for (int b = 0; b < num_blocks; b++)
+    {
+      const int start = b * mvec_block_size, end = std::min(start + mvec_block_size, N);
+      for (int j = 0; j < n; j++)
+      {
+        const double *Yj = Y[j];
+        double sum = 0.0;
+        for (int i = start; i < end; i++)
+        {
+          sum += Yj[i] * X[i];
+        }
+        loc[j] += sum;
+      }
+    }
+  }
+  for (int j = 0; j < n; j++)
+  {
+    dot[j] = 0.0;
+    for (int t = 0; t < nt; t++)
+    {
+      dot[j] += partial[static_cast<std::size_t>(t) * n + j];
+    }
+  }
+}
+
+void LocalMDot(const ComplexVector &x, const ComplexVector *y, int n,
+               std::complex<double> *dot)
+{
+  if (n == 0)
+  {
+    return;
+  }
+  if (!UseMultiVectorKernels())
+  {
+    for (int j = 0; j < n; j++)
+    {
+      dot[j] = LocalDot(x, y[j]);
+    }
+    return;
+  }
+  const int N = x.Size();
+  const auto *XR = x.Real().HostRead();
+  const auto *XI = x.Imag().HostRead();
+  std::vector<const double *> YR(n), YI(n);
+  for (int j = 0; j < n; j++)
+  {
+    MFEM_ASSERT(y[j].Size() == N, "Size mismatch for vector inner product!");
+    YR[j] = y[j].Real().HostRead();
+    YI[j] = y[j].Imag().HostRead();
+  }
+
+  // Same as the real-valued case, with yᴴ x = (yᵣᵀ xᵣ + yᵢᵀ xᵢ) + i (yᵣᵀ xᵢ - yᵢᵀ xᵣ).
+  const int num_blocks = (N + mvec_block_size - 1) / mvec_block_size;
+  const int nt = (num_blocks > 1) ? utils::GetMaxThreads() : 1;
+  std::vector<double> partial(static_cast<std::size_t>(nt) * 2 * n, 0.0);
+  PalacePragmaOmp(parallel if (nt > 1))
+  {
+    double *loc =
+        partial.data() + static_cast<std::size_t>(utils::GetThreadNum()) * 2 * n;
+    PalacePragmaOmp(for schedule(static))
+    for (int b = 0; b < num_blocks; b++)
+    {
+      const int start = b * mvec_block_size, end = std::min(start + mvec_block_size, N);
+      for (int j = 0; j < n; j++)
+      {
+        const double *YRj = YR[j], *YIj = YI[j];
+        double sumr = 0.0, sumi = 0.0;
+        for (int i = start; i < end; i++)
+        {
+          sumr += YRj[i] * XR[i] + YIj[i] * XI[i];
+          sumi += YRj[i] * XI[i] - YIj[i] * XR[i];
+        }
+        loc[2 * j] += sumr;
+        loc[2 * j + 1] += sumi;
+      }
+    }
+  }
+  for (int j = 0; j < n; j++)
+  {
+    double sumr = 0.0, sumi = 0.0;
+    for (int t = 0; t < nt; t++)
+    {
+      sumr += partial[static_cast<std::size_t>(t) * 2 * n + 2 * j];
+      sumi += partial[static_cast<std::size_t>(t) * 2 * n + 2 * j + 1];
+    }
+    dot[j] = {sumr, sumi};
+  }
+}
+
 double LocalSum(const Vector &x)
 {
   static hypre::HypreVector X;
@@ -734,6 +872,92 @@ void AXPBYPCZ(double alpha, const ComplexVector &x, double beta, const ComplexVe
   z.AXPBYPCZ(alpha, x, beta, y, gamma);
 }
 
+void MAXPY(int n, const double *alpha, const Vector *x, Vector &y, double s)
+{
+  if (n == 0)
+  {
+    return;
+  }
+  if (!UseMultiVectorKernels())
+  {
+    for (int j = 0; j < n; j++)
+    {
+      y.Add(s * alpha[j], x[j]);
+    }
+    return;
+  }
+  const int N = y.Size();
+  auto *Y = y.HostReadWrite();
+  std::vector<const double *> X(n);
+  std::vector<double> a(n);
+  for (int j = 0; j < n; j++)
+  {
+    MFEM_ASSERT(x[j].Size() == N, "Size mismatch for vector addition!");
+    X[j] = x[j].HostRead();
+    a[j] = s * alpha[j];
+  }
+  const int num_blocks = (N + mvec_block_size - 1) / mvec_block_size;
+  PalacePragmaOmp(parallel for schedule(static) if (num_blocks > 1))
+  for (int b = 0; b < num_blocks; b++)
+  {
+    const int start = b * mvec_block_size, end = std::min(start + mvec_block_size, N);
+    for (int j = 0; j < n; j++)
+    {
+      const double *Xj = X[j];
+      const double aj = a[j];
+      for (int i = start; i < end; i++)
+      {
+        Y[i] += aj * Xj[i];
+      }
+    }
+  }
+}
+
+void MAXPY(int n, const std::complex<double> *alpha, const ComplexVector *x,
+           ComplexVector &y, double s)
+{
+  if (n == 0)
+  {
+    return;
+  }
+  if (!UseMultiVectorKernels())
+  {
+    for (int j = 0; j < n; j++)
+    {
+      y.AXPY(s * alpha[j], x[j]);
+    }
+    return;
+  }
+  const int N = y.Size();
+  auto *YR = y.Real().HostReadWrite();
+  auto *YI = y.Imag().HostReadWrite();
+  std::vector<const double *> XR(n), XI(n);
+  std::vector<std::complex<double>> a(n);
+  for (int j = 0; j < n; j++)
+  {
+    MFEM_ASSERT(x[j].Size() == N, "Size mismatch for vector addition!");
+    XR[j] = x[j].Real().HostRead();
+    XI[j] = x[j].Imag().HostRead();
+    a[j] = s * alpha[j];
+  }
+  const int num_blocks = (N + mvec_block_size - 1) / mvec_block_size;
+  PalacePragmaOmp(parallel for schedule(static) if (num_blocks > 1))
+  for (int b = 0; b < num_blocks; b++)
+  {
+    const int start = b * mvec_block_size, end = std::min(start + mvec_block_size, N);
+    for (int j = 0; j < n; j++)
+    {
+      const double *XRj = XR[j], *XIj = XI[j];
+      const double ar = a[j].real(), ai = a[j].imag();
+      for (int i = start; i < end; i++)
+      {
+        YR[i] += ar * XRj[i] - ai * XIj[i];
+        YI[i] += ai * XRj[i] + ar * XIj[i];
+      }
+    }
+  }
+}
+
 void Sqrt(Vector &x, double s)
 {
   const bool use_dev = x.UseDevice();
@@ -192,6 +192,42 @@ inline auto Dot(MPI_Comm comm, const VecType &x, const VecType &y)
   return dot;
 }
 
+// Calculate the local indefinite inner product yᵀ x (without complex conjugation, identical
+// to LocalDot for real-valued vectors).
+inline double LocalTransposeDot(const Vector &x, const Vector &y)
+{
+  return LocalDot(x, y);
+}
+inline std::complex<double> LocalTransposeDot(const ComplexVector &x,
+                                              const ComplexVector &y)
+{
+  return x.TransposeDot(y);
+}
+
+// Calculate the parallel indefinite inner product yᵀ x.
+template <typename VecType>
+inline auto TransposeDot(MPI_Comm comm, const VecType &x, const VecType &y)
+{
+  auto dot = LocalTransposeDot(x, y);
+  Mpi::GlobalSum(1, &dot, comm);
+  return dot;
+}
+
+// Calculate the local inner products dot[j] = y[j]ᴴ x for j = 0, ..., n - 1 in a single
+// pass over x.
+void LocalMDot(const Vector &x, const Vector *y, int n, double *dot);
+void LocalMDot(const ComplexVector &x, const ComplexVector *y, int n,
+               std::complex<double> *dot);
+
+// Calculate the parallel inner products dot[j] = y[j]ᴴ x for j = 0, ..., n - 1 with a
+// single global reduction.
+template <typename VecType, typename ScalarType>
+inline void MDot(MPI_Comm comm, const VecType &x, const VecType *y, int n, ScalarType *dot)
+{
+  LocalMDot(x, y, n, dot);
+  Mpi::GlobalSum(n, dot, comm);
+}
+
 // Calculate the vector 2-norm.
 template <typename VecType>
 inline auto Norml2(MPI_Comm comm, const VecType &x)
@@ -246,6 +282,12 @@ template <typename VecType, typename ScalarType>
 void AXPBYPCZ(ScalarType alpha, const VecType &x, ScalarType beta, const VecType &y,
               ScalarType gamma, VecType &z);
 
+// Addition y += s * (alpha[0] * x[0] + ... + alpha[n - 1] * x[n - 1]) in a single pass
+// over y.
+void MAXPY(int n, const double *alpha, const Vector *x, Vector &y, double s = 1.0);
+void MAXPY(int n, const std::complex<double> *alpha, const ComplexVector *x,
+           ComplexVector &y, double s = 1.0);
+
 // Compute element-wise square root, optionally with scaling (multiplied before the square
 // root).
 void Sqrt(Vector &x, double s = 1.0);
@@ -303,12 +303,31 @@ int main(int argc, char *argv[])
     return nullptr;
   }();
 
+  // For frequency-parallel driven simulations, split the processes into groups which each
+  // hold their own copy of the mesh and solve for a subset of the frequency samples.
+  MPI_Comm comm = world_comm;
+  if (iodata.problem.type == config::ProblemData::Type::DRIVEN &&
+      iodata.solver.driven.n_group > 1)
+  {
+    const int n_group = iodata.solver.driven.n_group;
+    MFEM_VERIFY(world_size % n_group == 0,
+                "Number of MPI processes (" << world_size
+                                            << ") must be divisible by the number of "
+                                               "frequency groups ("
+                                            << n_group << ")!");
+    const int world_rank = Mpi::Rank(world_comm);
+    MPI_Comm_split(world_comm, world_rank / (world_size / n_group), world_rank, &comm);
+    Mpi::Print(world_comm, "Distributing frequency sweep over {:d} groups of {:d} MPI "
+                           "process{}\n\n",
+               n_group, world_size / n_group, (world_size / n_group > 1) ? "es" : "");
+  }
+
   // Read the mesh from file, refine, partition, and distribute it. Then nondimensionalize
   // it and the input parameters.
   std::vector<std::unique_ptr<Mesh>> mesh;
   {
     std::vector<std::unique_ptr<mfem::ParMesh>> mfem_mesh;
-    mfem_mesh.push_back(mesh::ReadMesh(world_comm, iodata));
+    mfem_mesh.push_back(mesh::ReadMesh(comm, iodata));
     iodata.NondimensionalizeInputs(*mfem_mesh[0]);
     mesh::RefineMesh(iodata, mfem_mesh);
     for (auto &m : mfem_mesh)
@@ -325,6 +344,13 @@ int main(int argc, char *argv[])
   solver->SaveMetadata(BlockTimer::GlobalTimer());
   Mpi::Print(world_comm, "\n");
 
+  // Release the communicator for the frequency group, if any.
+  if (comm != world_comm)
+  {
+    mesh.clear();
+    MPI_Comm_free(&comm);
+  }
+
   // Finalize libCEED.
   ceed::Finalize();
 
@@ -112,22 +112,49 @@ void FarfieldBoundaryOperator::AddExtraSystemBdrCoefficients(
   // COMSOL does as well.
   if (farfield_attr.Size() && order > 1)
   {
-    mfem::DenseTensor muinvc0 =
-        linalg::Mult(mat_op.GetInvPermeability(), mat_op.GetLightSpeed());
-    MaterialPropertyCoefficient muinvc0_func(mat_op.GetBdrAttributeToMaterial(), muinvc0);
-    muinvc0_func.RestrictCoefficient(mat_op.GetCeedBdrAttributes(farfield_attr));
+    AddSecondOrderBdrCoefficients(0.5 / omega, dfbi);
+  }
+}
 
-    // Instead getting the correct normal of farfield boundary elements, just pick the
-    // the first element normal. This is fine as long as the farfield material properties
-    // are not anisotropic.
-    mfem::Vector normal(mat_op.SpaceDimension());
-    normal = 0.0;
-    normal(0) = 1.0;
-    muinvc0_func.NormalProjectedCoefficient(normal);
+void FarfieldBoundaryOperator::AddExtraSystemBdrTerms(
+    std::vector<MaterialPropertyCoefficient> &dfb,
+    std::vector<MaterialPropertyCoefficient> &fb)
+{
+  // The second-order absorbing BC contribution is a single term with coefficient i/(2ω).
+  if (farfield_attr.Size() && order > 1)
+  {
+    AddSecondOrderBdrCoefficients(1.0, dfb.emplace_back(mat_op.MaxCeedBdrAttribute()));
+    fb.emplace_back(mat_op.MaxCeedBdrAttribute());
+  }
+}
 
-    dfbi.AddCoefficient(muinvc0_func.GetAttributeToMaterial(),
-                        muinvc0_func.GetMaterialProperties(), 0.5 / omega);
+void FarfieldBoundaryOperator::AddExtraSystemCoefficients(
+    double omega, std::vector<std::complex<double>> &coeff)
+{
+  if (farfield_attr.Size() && order > 1)
+  {
+    coeff.emplace_back(0.0, 0.5 / omega);
   }
 }
 
+void FarfieldBoundaryOperator::AddSecondOrderBdrCoefficients(
+    double coeff, MaterialPropertyCoefficient &dfb)
+{
+  mfem::DenseTensor muinvc0 =
+      linalg::Mult(mat_op.GetInvPermeability(), mat_op.GetLightSpeed());
+  MaterialPropertyCoefficient muinvc0_func(mat_op.GetBdrAttributeToMaterial(), muinvc0);
+  muinvc0_func.RestrictCoefficient(mat_op.GetCeedBdrAttributes(farfield_attr));
+
+  // Instead getting the correct normal of farfield boundary elements, just pick the
+  // the first element normal. This is fine as long as the farfield material properties
+  // are not anisotropic.
+  mfem::Vector normal(mat_op.SpaceDimension());
+  normal = 0.0;
+  normal(0) = 1.0;
+  muinvc0_func.NormalProjectedCoefficient(normal);
+
+  dfb.AddCoefficient(muinvc0_func.GetAttributeToMaterial(),
+                     muinvc0_func.GetMaterialProperties(), coeff);
+}
+
 }  // namespace palace
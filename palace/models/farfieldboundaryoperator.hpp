@@ -4,6 +4,8 @@
 #ifndef PALACE_MODELS_FARFIELD_BOUNDARY_OPERATOR_HPP
 #define PALACE_MODELS_FARFIELD_BOUNDARY_OPERATOR_HPP
 
+#include <complex>
+#include <vector>
 #include <mfem.hpp>
 
 namespace palace
@@ -30,6 +32,8 @@ private:
 
   mfem::Array<int> SetUpBoundaryProperties(const IoData &iodata, const mfem::ParMesh &mesh);
 
+  void AddSecondOrderBdrCoefficients(double coeff, MaterialPropertyCoefficient &dfb);
+
 public:
   FarfieldBoundaryOperator(const IoData &iodata, const MaterialOperator &mat_op,
                            const mfem::ParMesh &mesh);
@@ -45,6 +49,12 @@ public:
   void AddDampingBdrCoefficients(double coeff, MaterialPropertyCoefficient &fb);
   void AddExtraSystemBdrCoefficients(double omega, MaterialPropertyCoefficient &dfbr,
                                      MaterialPropertyCoefficient &dfbi);
+
+  // Add the frequency-independent terms of the extra system matrix contributions, one per
+  // entry of dfb and fb, and the corresponding frequency-dependent scalar coefficients.
+  void AddExtraSystemBdrTerms(std::vector<MaterialPropertyCoefficient> &dfb,
+                              std::vector<MaterialPropertyCoefficient> &fb);
+  void AddExtraSystemCoefficients(double omega, std::vector<std::complex<double>> &coeff);
 };
 
 }  // namespace palace
@@ -224,51 +224,19 @@ std::complex<double> LumpedPortData::GetPower(GridFunction &E, GridFunction &B)
 {
   // Compute port power, (E x H) ⋅ n = E ⋅ (-n x H), integrated over the port surface using
   // the computed E and H = μ⁻¹ B fields, where +n is the direction of propagation (into the
-  // domain). The BdrSurfaceCurrentVectorCoefficient computes -n x H for an outward normal,
-  // so we multiply by -1. The linear form is reconstructed from scratch each time due to
-  // changing H.
+  // domain). The linear forms are reconstructed from scratch each time due to changing H.
   MFEM_VERIFY((E.HasImag() && B.HasImag()) || (!E.HasImag() && !B.HasImag()),
               "Mismatch between real- and complex-valued E and B fields in port power "
               "calculation!");
   const bool has_imag = E.HasImag();
   auto &nd_fespace = *E.ParFESpace();
-  const auto &mesh = *nd_fespace.GetParMesh();
-  SumVectorCoefficient fbr(mesh.SpaceDimension()), fbi(mesh.SpaceDimension());
-  mfem::Array<int> attr_list;
-  for (const auto &elem : elems)
-  {
-    fbr.AddCoefficient(
-        std::make_unique<RestrictedVectorCoefficient<BdrSurfaceCurrentVectorCoefficient>>(
-            elem->GetAttrList(), B.Real(), mat_op));
-    if (has_imag)
-    {
-      fbi.AddCoefficient(
-          std::make_unique<RestrictedVectorCoefficient<BdrSurfaceCurrentVectorCoefficient>>(
-              elem->GetAttrList(), B.Imag(), mat_op));
-    }
-    attr_list.Append(elem->GetAttrList());
-  }
-  int bdr_attr_max = mesh.bdr_attributes.Size() ? mesh.bdr_attributes.Max() : 0;
-  mfem::Array<int> attr_marker = mesh::AttrToMarker(bdr_attr_max, attr_list);
-  std::complex<double> dot;
-  {
-    mfem::LinearForm pr(&nd_fespace);
-    pr.AddBoundaryIntegrator(new VectorFEBoundaryLFIntegrator(fbr), attr_marker);
-    pr.UseFastAssembly(false);
-    pr.UseDevice(false);
-    pr.Assemble();
-    pr.UseDevice(true);
-    dot = -(pr * E.Real()) + (has_imag ? -1i * (pr * E.Imag()) : 0.0);
-  }
+  mfem::Vector l;
+  GetPowerFunctional(B.Real(), nd_fespace, l);
+  std::complex<double> dot(l * E.Real(), has_imag ? l * E.Imag() : 0.0);
   if (has_imag)
   {
-    mfem::LinearForm pi(&nd_fespace);
-    pi.AddBoundaryIntegrator(new VectorFEBoundaryLFIntegrator(fbi), attr_marker);
-    pi.UseFastAssembly(false);
-    pi.UseDevice(false);
-    pi.Assemble();
-    pi.UseDevice(true);
-    dot += -(pi * E.Imag()) + 1i * (pi * E.Real());
+    GetPowerFunctional(B.Imag(), nd_fespace, l);
+    dot += (l * E.Imag()) - 1i * (l * E.Real());
     Mpi::GlobalSum(1, &dot, E.ParFESpace()->GetComm());
     return dot;
   }
@@ -306,6 +274,52 @@ std::complex<double> LumpedPortData::GetVoltage(GridFunction &E) const
   return dot;
 }
 
+void LumpedPortData::GetSParameterFunctional(mfem::ParFiniteElementSpace &nd_fespace,
+                                             mfem::Vector &l) const
+{
+  InitializeLinearForms(nd_fespace);
+  l.SetSize(nd_fespace.GetTrueVSize());
+  l.UseDevice(true);
+  nd_fespace.GetProlongationMatrix()->MultTranspose(*s, l);
+}
+
+void LumpedPortData::GetVoltageFunctional(mfem::ParFiniteElementSpace &nd_fespace,
+                                          mfem::Vector &l) const
+{
+  InitializeLinearForms(nd_fespace);
+  l.SetSize(nd_fespace.GetTrueVSize());
+  l.UseDevice(true);
+  nd_fespace.GetProlongationMatrix()->MultTranspose(*v, l);
+}
+
+void LumpedPortData::GetPowerFunctional(const mfem::ParGridFunction &B,
+                                        mfem::ParFiniteElementSpace &nd_fespace,
+                                        mfem::Vector &l) const
+{
+  // The BdrSurfaceCurrentVectorCoefficient computes -n x H for an outward normal, so we
+  // multiply by -1.
+  const auto &mesh = *nd_fespace.GetParMesh();
+  SumVectorCoefficient fb(mesh.SpaceDimension());
+  mfem::Array<int> attr_list;
+  for (const auto &elem : elems)
+  {
+    fb.AddCoefficient(
+        std::make_unique<RestrictedVectorCoefficient<BdrSurfaceCurrentVectorCoefficient>>(
+            elem->GetAttrList(), B, mat_op));
+    attr_list.Append(elem->GetAttrList());
+  }
+  int bdr_attr_max = mesh.bdr_attributes.Size() ? mesh.bdr_attributes.Max() : 0;
+  mfem::Array<int> attr_marker = mesh::AttrToMarker(bdr_attr_max, attr_list);
+  mfem::LinearForm p(&nd_fespace);
+  p.AddBoundaryIntegrator(new VectorFEBoundaryLFIntegrator(fb), attr_marker);
+  p.UseFastAssembly(false);
+  p.UseDevice(false);
+  p.Assemble();
+  l.SetSize(p.Size());
+  l.UseDevice(true);
+  l.Set(-1.0, p);
+}
+
 LumpedPortOperator::LumpedPortOperator(const IoData &iodata, const MaterialOperator &mat_op,
                                        const mfem::ParMesh &mesh)
 {
@@ -491,6 +505,16 @@ const LumpedPortData &LumpedPortOperator::GetPort(int idx) const
   return it->second;
 }
 
+void LumpedPortOperator::SetExcitation(int idx, bool excitation)
+{
+  auto it = ports.find(idx);
+  MFEM_VERIFY(it != ports.end(), "Unknown lumped port index requested!");
+  const auto &data = it->second;
+  MFEM_VERIFY(!excitation || (data.R > 0.0 && data.L == 0.0 && data.C == 0.0),
+              "Excited lumped port must have nonzero resistance and zero reactance!");
+  it->second.excitation = excitation;
+}
+
 mfem::Array<int> LumpedPortOperator::GetAttrList() const
 {
   mfem::Array<int> attr_list;
@@ -75,6 +75,18 @@ public:
   std::complex<double> GetPower(GridFunction &E, GridFunction &B) const;
   std::complex<double> GetSParameter(GridFunction &E) const;
   std::complex<double> GetVoltage(GridFunction &E) const;
+
+  // Get the linear functionals on the true dofs of the electric field which compute the
+  // port S-parameter (without the incident contribution) and voltage, q = lᵀ E.
+  void GetSParameterFunctional(mfem::ParFiniteElementSpace &nd_fespace,
+                               mfem::Vector &l) const;
+  void GetVoltageFunctional(mfem::ParFiniteElementSpace &nd_fespace, mfem::Vector &l) const;
+
+  // Get the linear functional on the local dofs of the electric field which computes the
+  // port power for a real-valued magnetic flux density B, P = lᵀ E (summed over all
+  // processes).
+  void GetPowerFunctional(const mfem::ParGridFunction &B,
+                          mfem::ParFiniteElementSpace &nd_fespace, mfem::Vector &l) const;
 };
 
 //
@@ -104,6 +116,10 @@ public:
   auto rend() const { return ports.rend(); }
   auto Size() const { return ports.size(); }
 
+  // Enable or disable the excitation for the lumped port with the given index, for exciting
+  // ports one at a time.
+  void SetExcitation(int idx, bool excitation);
+
   // Returns array of lumped port attributes.
   mfem::Array<int> GetAttrList() const;
   mfem::Array<int> GetRsAttrList() const;
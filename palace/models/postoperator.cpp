@@ -34,6 +34,59 @@ auto CreateParaviewPath(const IoData &iodata, const std::string &name)
   return path;
 }
 
+Eigen::MatrixXd ProjectReducedMatrix(MPI_Comm comm, const Operator &M,
+                                     const std::vector<Vector> &X)
+{
+  // Compute Xᵀ M X for the local (not true) dof vectors X, where the local operator M sums
+  // to the global bilinear form across processes.
+  const auto n = X.size();
+  Eigen::MatrixXd Mr(n, n);
+  Vector t(M.Height());
+  for (std::size_t j = 0; j < n; j++)
+  {
+    M.Mult(X[j], t);
+    for (std::size_t i = 0; i < n; i++)
+    {
+      Mr(i, j) = linalg::LocalDot(X[i], t);
+    }
+  }
+  Mpi::GlobalSum(n * n, Mr.data(), comm);
+  return Mr;
+}
+
+double ReducedEnergy(const Eigen::MatrixXd &M, const Eigen::VectorXcd &y)
+{
+  // Compute 1/2 Re{yᴴ M y} for real symmetric M.
+  const Eigen::VectorXd yr = y.real(), yi = y.imag();
+  return 0.5 * (yr.dot(M * yr) + yi.dot(M * yi));
+}
+
+std::complex<double> ReducedDot(const Eigen::VectorXd &v, const Eigen::VectorXcd &y)
+{
+  return {v.dot(y.real()), v.dot(y.imag())};
+}
+
+std::complex<double> ReducedPower(const Eigen::MatrixXd &P, const Eigen::VectorXcd &y,
+                                  double omega)
+{
+  // Compute the port power for E = V y and B = -1/(iω) ∇ x V y from the real-valued matrix
+  // P with P_jk = P(E = V_k, B = ∇ x V_j), which is sesquilinear in (E, B).
+  return std::conj(-1.0 / (1i * omega)) * y.dot(P.cast<std::complex<double>>() * y);
+}
+
+std::vector<std::complex<double>> ReducedProbe(const Eigen::MatrixXd &P,
+                                               const Eigen::VectorXcd &y,
+                                               std::complex<double> a)
+{
+  const Eigen::VectorXd vr = P * y.real(), vi = P * y.imag();
+  std::vector<std::complex<double>> v(P.rows());
+  for (std::size_t i = 0; i < v.size(); i++)
+  {
+    v[i] = a * std::complex<double>(vr(i), vi(i));
+  }
+  return v;
+}
+
 }  // namespace
 
 PostOperator::PostOperator(const IoData &iodata, SpaceOperator &space_op,
@@ -48,11 +101,8 @@ PostOperator::PostOperator(const IoData &iodata, SpaceOperator &space_op,
     B(std::make_unique<GridFunction>(space_op.GetRTSpace(),
                                      iodata.problem.type !=
                                          config::ProblemData::Type::TRANSIENT)),
-    lumped_port_init(false), wave_port_init(false),
-    paraview(CreateParaviewPath(iodata, name), &space_op.GetNDSpace().GetParMesh()),
-    paraview_bdr(CreateParaviewPath(iodata, name) + "_boundary",
-                 &space_op.GetNDSpace().GetParMesh()),
-    interp_op(iodata, space_op.GetNDSpace().GetParMesh())
+    lumped_port_init(false), wave_port_init(false), reduced_init(false),
+    paraview_idx(0), interp_op(iodata, space_op.GetNDSpace().GetParMesh())
 {
   bool side_n_min = (iodata.boundaries.postpro.side ==
                      config::InterfaceDielectricData::Side::SMALLER_REF_INDEX);
@@ -85,7 +135,7 @@ PostOperator::PostOperator(const IoData &iodata, SpaceOperator &space_op,
   }
 
   // Initialize data collection objects.
-  InitializeDataCollection(iodata);
+  AddDataCollection(iodata, name);
 }
 
 PostOperator::PostOperator(const IoData &iodata, LaplaceOperator &laplace_op,
@@ -95,11 +145,8 @@ PostOperator::PostOperator(const IoData &iodata, LaplaceOperator &laplace_op,
     dom_post_op(iodata, laplace_op.GetMaterialOp(), laplace_op.GetH1Space()),
     E(std::make_unique<GridFunction>(laplace_op.GetNDSpace())),
     V(std::make_unique<GridFunction>(laplace_op.GetH1Space())), lumped_port_init(false),
-    wave_port_init(false),
-    paraview(CreateParaviewPath(iodata, name), &laplace_op.GetNDSpace().GetParMesh()),
-    paraview_bdr(CreateParaviewPath(iodata, name) + "_boundary",
-                 &laplace_op.GetNDSpace().GetParMesh()),
-    interp_op(iodata, laplace_op.GetNDSpace().GetParMesh())
+    wave_port_init(false), reduced_init(false),
+    paraview_idx(0), interp_op(iodata, laplace_op.GetNDSpace().GetParMesh())
 {
   // Note: When using this constructor, you should not use any of the magnetic field related
   // postprocessing functions (magnetic field energy, inductor energy, surface currents,
@@ -115,7 +162,7 @@ PostOperator::PostOperator(const IoData &iodata, LaplaceOperator &laplace_op,
       &E->Real(), nullptr, mat_op, true, mfem::Vector());
 
   // Initialize data collection objects.
-  InitializeDataCollection(iodata);
+  AddDataCollection(iodata, name);
 }
 
 PostOperator::PostOperator(const IoData &iodata, CurlCurlOperator &curlcurl_op,
@@ -125,11 +172,8 @@ PostOperator::PostOperator(const IoData &iodata, CurlCurlOperator &curlcurl_op,
     dom_post_op(iodata, curlcurl_op.GetMaterialOp(), curlcurl_op.GetNDSpace()),
     B(std::make_unique<GridFunction>(curlcurl_op.GetRTSpace())),
     A(std::make_unique<GridFunction>(curlcurl_op.GetNDSpace())), lumped_port_init(false),
-    wave_port_init(false),
-    paraview(CreateParaviewPath(iodata, name), &curlcurl_op.GetNDSpace().GetParMesh()),
-    paraview_bdr(CreateParaviewPath(iodata, name) + "_boundary",
-                 &curlcurl_op.GetNDSpace().GetParMesh()),
-    interp_op(iodata, curlcurl_op.GetNDSpace().GetParMesh())
+    wave_port_init(false), reduced_init(false),
+    paraview_idx(0), interp_op(iodata, curlcurl_op.GetNDSpace().GetParMesh())
 {
   // Note: When using this constructor, you should not use any of the electric field related
   // postprocessing functions (electric field energy, capacitor energy, surface charge,
@@ -144,10 +188,10 @@ PostOperator::PostOperator(const IoData &iodata, CurlCurlOperator &curlcurl_op,
   J_sr = std::make_unique<BdrSurfaceCurrentVectorCoefficient>(B->Real(), mat_op);
 
   // Initialize data collection objects.
-  InitializeDataCollection(iodata);
+  AddDataCollection(iodata, name);
 }
 
-void PostOperator::InitializeDataCollection(const IoData &iodata)
+int PostOperator::AddDataCollection(const IoData &iodata, const std::string &name)
 {
   // Set up postprocessing for output to disk. Results are stored in a directory at
   // `iodata.problem.output/paraview`.
@@ -161,20 +205,27 @@ void PostOperator::InitializeDataCollection(const IoData &iodata)
   const int refine_ho = HasE() ? E->ParFESpace()->GetMaxElementOrder()
                                : B->ParFESpace()->GetMaxElementOrder();
   mesh_Lc0 = iodata.GetMeshLengthScale();
+  mfem::ParMesh &mesh =
+      HasE() ? *E->ParFESpace()->GetParMesh() : *B->ParFESpace()->GetParMesh();
+  const std::string path = CreateParaviewPath(iodata, name);
+  auto &pv = *paraview.emplace_back(
+      std::make_unique<mfem::ParaViewDataCollection>(path, &mesh));
+  auto &pv_bdr = *paraview_bdr.emplace_back(
+      std::make_unique<mfem::ParaViewDataCollection>(path + "_boundary", &mesh));
 
   // Output mesh coordinate units same as input.
-  paraview.SetCycle(-1);
-  paraview.SetDataFormat(format);
-  paraview.SetCompressionLevel(compress);
-  paraview.SetHighOrderOutput(use_ho);
-  paraview.SetLevelsOfDetail(refine_ho);
-
-  paraview_bdr.SetBoundaryOutput(true);
-  paraview_bdr.SetCycle(-1);
-  paraview_bdr.SetDataFormat(format);
-  paraview_bdr.SetCompressionLevel(compress);
-  paraview_bdr.SetHighOrderOutput(use_ho);
-  paraview_bdr.SetLevelsOfDetail(refine_ho);
+  pv.SetCycle(-1);
+  pv.SetDataFormat(format);
+  pv.SetCompressionLevel(compress);
+  pv.SetHighOrderOutput(use_ho);
+  pv.SetLevelsOfDetail(refine_ho);
+
+  pv_bdr.SetBoundaryOutput(true);
+  pv_bdr.SetCycle(-1);
+  pv_bdr.SetDataFormat(format);
+  pv_bdr.SetCompressionLevel(compress);
+  pv_bdr.SetHighOrderOutput(use_ho);
+  pv_bdr.SetLevelsOfDetail(refine_ho);
 
   // Output fields @ phase = 0 and π/2 for frequency domain (rather than, for example,
   // peak phasors or magnitude = sqrt(2) * RMS). Also output fields evaluated on mesh
@@ -185,59 +236,59 @@ void PostOperator::InitializeDataCollection(const IoData &iodata)
   {
     if (HasImag())
     {
-      paraview.RegisterField("E_real", &E->Real());
-      paraview.RegisterField("E_imag", &E->Imag());
-      paraview_bdr.RegisterVCoeffField("E_real", E_sr.get());
-      paraview_bdr.RegisterVCoeffField("E_imag", E_si.get());
+      pv.RegisterField("E_real", &E->Real());
+      pv.RegisterField("E_imag", &E->Imag());
+      pv_bdr.RegisterVCoeffField("E_real", E_sr.get());
+      pv_bdr.RegisterVCoeffField("E_imag", E_si.get());
     }
     else
     {
-      paraview.RegisterField("E", &E->Real());
-      paraview_bdr.RegisterVCoeffField("E", E_sr.get());
+      pv.RegisterField("E", &E->Real());
+      pv_bdr.RegisterVCoeffField("E", E_sr.get());
     }
   }
   if (B)
   {
     if (HasImag())
     {
-      paraview.RegisterField("B_real", &B->Real());
-      paraview.RegisterField("B_imag", &B->Imag());
-      paraview_bdr.RegisterVCoeffField("B_real", B_sr.get());
-      paraview_bdr.RegisterVCoeffField("B_imag", B_si.get());
+      pv.RegisterField("B_real", &B->Real());
+      pv.RegisterField("B_imag", &B->Imag());
+      pv_bdr.RegisterVCoeffField("B_real", B_sr.get());
+      pv_bdr.RegisterVCoeffField("B_imag", B_si.get());
     }
     else
     {
-      paraview.RegisterField("B", &B->Real());
-      paraview_bdr.RegisterVCoeffField("B", B_sr.get());
+      pv.RegisterField("B", &B->Real());
+      pv_bdr.RegisterVCoeffField("B", B_sr.get());
     }
   }
   if (V)
   {
-    paraview.RegisterField("V", &V->Real());
-    paraview_bdr.RegisterCoeffField("V", V_s.get());
+    pv.RegisterField("V", &V->Real());
+    pv_bdr.RegisterCoeffField("V", V_s.get());
   }
   if (A)
   {
-    paraview.RegisterField("A", &A->Real());
-    paraview_bdr.RegisterVCoeffField("A", A_s.get());
+    pv.RegisterField("A", &A->Real());
+    pv_bdr.RegisterVCoeffField("A", A_s.get());
   }
 
   // Extract energy density field for electric field energy 1/2 Dᴴ E or magnetic field
   // energy 1/2 Hᴴ B. Also Poynting vector S = E x H⋆.
   if (U_e)
   {
-    paraview.RegisterCoeffField("U_e", U_e.get());
-    paraview_bdr.RegisterCoeffField("U_e", U_e.get());
+    pv.RegisterCoeffField("U_e", U_e.get());
+    pv_bdr.RegisterCoeffField("U_e", U_e.get());
   }
   if (U_m)
   {
-    paraview.RegisterCoeffField("U_m", U_m.get());
-    paraview_bdr.RegisterCoeffField("U_m", U_m.get());
+    pv.RegisterCoeffField("U_m", U_m.get());
+    pv_bdr.RegisterCoeffField("U_m", U_m.get());
   }
   if (S)
   {
-    paraview.RegisterVCoeffField("S", S.get());
-    paraview_bdr.RegisterVCoeffField("S", S.get());
+    pv.RegisterVCoeffField("S", S.get());
+    pv_bdr.RegisterVCoeffField("S", S.get());
   }
 
   // Extract surface charge from normally discontinuous ND E-field. Also extract surface
@@ -247,33 +298,35 @@ void PostOperator::InitializeDataCollection(const IoData &iodata)
   {
     if (HasImag())
     {
-      paraview_bdr.RegisterCoeffField("Q_s_real", Q_sr.get());
-      paraview_bdr.RegisterCoeffField("Q_s_imag", Q_si.get());
+      pv_bdr.RegisterCoeffField("Q_s_real", Q_sr.get());
+      pv_bdr.RegisterCoeffField("Q_s_imag", Q_si.get());
     }
     else
     {
-      paraview_bdr.RegisterCoeffField("Q_s", Q_sr.get());
+      pv_bdr.RegisterCoeffField("Q_s", Q_sr.get());
     }
   }
   if (J_sr)
   {
     if (HasImag())
     {
-      paraview_bdr.RegisterVCoeffField("J_s_real", J_sr.get());
-      paraview_bdr.RegisterVCoeffField("J_s_imag", J_si.get());
+      pv_bdr.RegisterVCoeffField("J_s_real", J_sr.get());
+      pv_bdr.RegisterVCoeffField("J_s_imag", J_si.get());
     }
     else
     {
-      paraview_bdr.RegisterVCoeffField("J_s", J_sr.get());
+      pv_bdr.RegisterVCoeffField("J_s", J_sr.get());
     }
   }
 
   // Add wave port boundary mode postprocessing when available.
   for (const auto &[idx, data] : port_E0)
   {
-    paraview_bdr.RegisterVCoeffField("E0_" + std::to_string(idx) + "_real", data.E0r.get());
-    paraview_bdr.RegisterVCoeffField("E0_" + std::to_string(idx) + "_imag", data.E0i.get());
+    pv_bdr.RegisterVCoeffField("E0_" + std::to_string(idx) + "_real", data.E0r.get());
+    pv_bdr.RegisterVCoeffField("E0_" + std::to_string(idx) + "_imag", data.E0i.get());
   }
+
+  return static_cast<int>(paraview.size()) - 1;
 }
 
 void PostOperator::SetEGridFunction(const ComplexVector &e, bool exchange_face_nbr_data)
@@ -288,7 +341,7 @@ void PostOperator::SetEGridFunction(const ComplexVector &e, bool exchange_face_n
     E->Real().ExchangeFaceNbrData();  // Ready for parallel comm on shared faces
     E->Imag().ExchangeFaceNbrData();
   }
-  lumped_port_init = wave_port_init = false;
+  lumped_port_init = wave_port_init = reduced_init = false;
 }
 
 void PostOperator::SetBGridFunction(const ComplexVector &b, bool exchange_face_nbr_data)
@@ -303,7 +356,7 @@ void PostOperator::SetBGridFunction(const ComplexVector &b, bool exchange_face_n
     B->Real().ExchangeFaceNbrData();  // Ready for parallel comm on shared faces
     B->Imag().ExchangeFaceNbrData();
   }
-  lumped_port_init = wave_port_init = false;
+  lumped_port_init = wave_port_init = reduced_init = false;
 }
 
 void PostOperator::SetEGridFunction(const Vector &e, bool exchange_face_nbr_data)
@@ -316,7 +369,7 @@ void PostOperator::SetEGridFunction(const Vector &e, bool exchange_face_nbr_data
   {
     E->Real().ExchangeFaceNbrData();
   }
-  lumped_port_init = wave_port_init = false;
+  lumped_port_init = wave_port_init = reduced_init = false;
 }
 
 void PostOperator::SetBGridFunction(const Vector &b, bool exchange_face_nbr_data)
@@ -329,7 +382,7 @@ void PostOperator::SetBGridFunction(const Vector &b, bool exchange_face_nbr_data
   {
     B->Real().ExchangeFaceNbrData();
   }
-  lumped_port_init = wave_port_init = false;
+  lumped_port_init = wave_port_init = reduced_init = false;
 }
 
 void PostOperator::SetVGridFunction(const Vector &v, bool exchange_face_nbr_data)
@@ -356,8 +409,121 @@ void PostOperator::SetAGridFunction(const Vector &a, bool exchange_face_nbr_data
   }
 }
 
+bool PostOperator::SetReducedBasis(const std::vector<Vector> &V, int n,
+                                   const Operator &Curl,
+                                   const LumpedPortOperator &lumped_port_op,
+                                   const WavePortOperator &wave_port_op)
+{
+  // The postprocessed quantities for the reduced-order solution E = V y are linear (port
+  // voltages and S-parameters, probes) or quadratic (energies) in y, with coefficients
+  // which are computed once here from the basis. Wave port and surface postprocessing
+  // depend on the frequency or require the full field and are not supported.
+  reduced.reset();
+  reduced_init = false;
+  if (!E || !B || !HasImag() || !dom_post_op.M_elec || !dom_post_op.M_mag ||
+      wave_port_op.Size() > 0 ||
+      !surf_post_op.flux_surfs.empty() || !surf_post_op.eps_surfs.empty())
+  {
+    return false;
+  }
+  MPI_Comm comm = GetComm();
+  reduced = std::make_unique<ReducedPostData>();
+
+  // Distribute the basis vectors and their curls to the local dofs.
+  std::vector<Vector> EL(n), BL(n);
+  {
+    Vector b(Curl.Height());
+    for (int j = 0; j < n; j++)
+    {
+      E->Real().SetFromTrueDofs(V[j]);
+      EL[j] = E->Real();
+      Curl.Mult(V[j], b);
+      B->Real().SetFromTrueDofs(b);
+      BL[j] = B->Real();
+    }
+  }
+
+  // Project the domain energy bilinear forms.
+  reduced->M_elec = ProjectReducedMatrix(comm, *dom_post_op.M_elec, EL);
+  reduced->M_mag = ProjectReducedMatrix(comm, *dom_post_op.M_mag, BL);
+  for (const auto &[idx, data] : dom_post_op.M_i)
+  {
+    reduced->M_i.emplace(idx, std::make_pair(ProjectReducedMatrix(comm, *data.first, EL),
+                                             ProjectReducedMatrix(comm, *data.second, BL)));
+  }
+
+  // Evaluate the lumped port voltage and S-parameter linear forms and the field probes for
+  // each basis vector, and the lumped port power for each pair of basis vectors.
+  for (const auto &[idx, data] : lumped_port_op)
+  {
+    reduced->lumped_port_vs.emplace(idx,
+                                    std::make_pair(Eigen::VectorXd(n), Eigen::VectorXd(n)));
+    reduced->lumped_port_p.emplace(idx, Eigen::MatrixXd(n, n));
+  }
+  Vector l;
+  const bool probes = !GetProbes().empty();
+  E->Imag() = 0.0;
+  B->Imag() = 0.0;
+  for (int j = 0; j < n; j++)
+  {
+    E->Real() = EL[j];
+    B->Real() = BL[j];
+    for (const auto &[idx, data] : lumped_port_op)
+    {
+      auto &[v, s] = reduced->lumped_port_vs.at(idx);
+      v(j) = data.GetVoltage(*E).real();
+      s(j) = data.GetSParameter(*E).real();
+      auto &p = reduced->lumped_port_p.at(idx);
+      data.GetPowerFunctional(B->Real(), *E->ParFESpace(), l);
+      for (int k = 0; k < n; k++)
+      {
+        p(j, k) = l * EL[k];
+      }
+    }
+    if (probes)
+    {
+      const auto vE = interp_op.ProbeField(*E);
+      const auto vB = interp_op.ProbeField(*B);
+      if (j == 0)
+      {
+        reduced->probe_E.resize(vE.size(), n);
+        reduced->probe_B.resize(vB.size(), n);
+      }
+      for (std::size_t i = 0; i < vE.size(); i++)
+      {
+        reduced->probe_E(i, j) = vE[i].real();
+      }
+      for (std::size_t i = 0; i < vB.size(); i++)
+      {
+        reduced->probe_B(i, j) = vB[i].real();
+      }
+    }
+  }
+  for (auto &[idx, p] : reduced->lumped_port_p)
+  {
+    Mpi::GlobalSum(n * n, p.data(), comm);
+  }
+  lumped_port_init = wave_port_init = false;
+  return true;
+}
+
+void PostOperator::SetReducedSolution(const Eigen::VectorXcd &y, double omega)
+{
+  MFEM_VERIFY(reduced && y.size() == reduced->M_elec.rows(),
+              "Reduced-order postprocessing requires a call to SetReducedBasis with a "
+              "basis of matching dimension!");
+  reduced->y = y;
+  reduced->omega = omega;
+  reduced_init = true;
+  lumped_port_init = wave_port_init = false;
+}
+
 double PostOperator::GetEFieldEnergy() const
 {
+  if (reduced_init)
+  {
+    return ReducedEnergy(reduced->M_elec, reduced->y);
+  }
   if (V)
   {
     return dom_post_op.GetElectricFieldEnergy(*V);
@@ -371,6 +537,10 @@ double PostOperator::GetEFieldEnergy() const
 
 double PostOperator::GetHFieldEnergy() const
 {
+  if (reduced_init)
+  {
+    return ReducedEnergy(reduced->M_mag, reduced->y) / (reduced->omega * reduced->omega);
+  }
   if (A)
   {
     return dom_post_op.GetMagneticFieldEnergy(*A);
@@ -384,6 +554,13 @@ double PostOperator::GetHFieldEnergy() const
 
 double PostOperator::GetEFieldEnergy(int idx) const
 {
+  if (reduced_init)
+  {
+    const auto it = reduced->M_i.find(idx);
+    MFEM_VERIFY(it != reduced->M_i.end(),
+                "Invalid domain index when postprocessing domain electric field energy!");
+    return ReducedEnergy(it->second.first, reduced->y);
+  }
   if (V)
   {
     return dom_post_op.GetDomainElectricFieldEnergy(idx, *V);
@@ -397,6 +574,14 @@ double PostOperator::GetEFieldEnergy(int idx) const
 
 double PostOperator::GetHFieldEnergy(int idx) const
 {
+  if (reduced_init)
+  {
+    const auto it = reduced->M_i.find(idx);
+    MFEM_VERIFY(it != reduced->M_i.end(),
+                "Invalid domain index when postprocessing domain magnetic field energy!");
+    return ReducedEnergy(it->second.second, reduced->y) /
+           (reduced->omega * reduced->omega);
+  }
   if (A)
   {
     return dom_post_op.GetDomainMagneticFieldEnergy(idx, *A);
@@ -413,6 +598,8 @@ std::complex<double> PostOperator::GetSurfaceFlux(int idx) const
   // Compute the flux through a surface as Φ_j = ∫ F ⋅ n_j dS, with F = B, F = ε D, or F =
   // E x H. The special coefficient is used to avoid issues evaluating MFEM GridFunctions
   // which are discontinuous at interior boundary elements.
+  MFEM_VERIFY(!reduced_init,
+              "Surface flux postprocessing is not available for reduced-order solutions!");
   return surf_post_op.GetSurfaceFlux(idx, E.get(), B.get());
 }
 
@@ -424,6 +611,8 @@ double PostOperator::GetInterfaceParticipation(int idx, double E_m) const
   // with:
   //          p_mj = 1/2 t_j Re{∫_{Γ_j} (ε_j E_m)ᴴ E_m dS} /(E_elec + E_cap).
   MFEM_VERIFY(E, "Surface Q not defined, no electric field solution found!");
+  MFEM_VERIFY(!reduced_init, "Interface dielectric postprocessing is not available for "
+                             "reduced-order solutions!");
   return surf_post_op.GetInterfaceElectricFieldEnergy(idx, *E) / E_m;
 }
 
@@ -437,8 +626,22 @@ void PostOperator::UpdatePorts(const LumpedPortOperator &lumped_port_op, double
   for (const auto &[idx, data] : lumped_port_op)
   {
     auto &vi = lumped_port_vi[idx];
-    vi.P = data.GetPower(*E, *B);
-    vi.V = data.GetVoltage(*E);
+    if (reduced_init)
+    {
+      const auto &[v, s] = reduced->lumped_port_vs.at(idx);
+      vi.P = ReducedPower(reduced->lumped_port_p.at(idx), reduced->y, reduced->omega);
+      vi.V = ReducedDot(v, reduced->y);
+      vi.S = ReducedDot(s, reduced->y);
+    }
+    else
+    {
+      vi.P = data.GetPower(*E, *B);
+      vi.V = data.GetVoltage(*E);
+      if (HasImag())
+      {
+        vi.S = data.GetSParameter(*E);
+      }
+    }
     if (HasImag())
     {
       // Compute current from the port impedance, separate contributions for R, L, C
@@ -458,7 +661,6 @@ void PostOperator::UpdatePorts(const LumpedPortOperator &lumped_port_op, double
           (std::abs(data.C) > 0.0)
               ? vi.V / data.GetCharacteristicImpedance(omega, LumpedPortData::Branch::C)
               : 0.0;
-      vi.S = data.GetSParameter(*E);
     }
     else
     {
@@ -473,6 +675,8 @@ void PostOperator::UpdatePorts(const LumpedPortOperator &lumped_port_op, double
 void PostOperator::UpdatePorts(const WavePortOperator &wave_port_op, double omega)
 {
   MFEM_VERIFY(HasImag() && E && B, "Incorrect usage of PostOperator::UpdatePorts!");
+  MFEM_VERIFY(!reduced_init || wave_port_op.Size() == 0,
+              "Wave port postprocessing is not available for reduced-order solutions!");
   if (wave_port_init)
   {
     return;
@@ -726,16 +930,21 @@ void PostOperator::WriteFields(int step, double time) const
 {
   // Given the electric field and magnetic flux density, write the fields to disk for
   // visualization. Write the mesh coordinates in the same units as originally input.
+  MFEM_VERIFY(!reduced_init,
+              "Field output is not available for reduced-order solutions, set the grid "
+              "functions from the high-dimensional solution!");
   mfem::ParMesh &mesh =
       HasE() ? *E->ParFESpace()->GetParMesh() : *B->ParFESpace()->GetParMesh();
+  auto &pv = *paraview[paraview_idx];
+  auto &pv_bdr = *paraview_bdr[paraview_idx];
   mesh::DimensionalizeMesh(mesh, mesh_Lc0);
   ScaleGridFunctions(mesh_Lc0, mesh.Dimension(), HasImag(), E, B, V, A);
-  paraview.SetCycle(step);
-  paraview.SetTime(time);
-  paraview_bdr.SetCycle(step);
-  paraview_bdr.SetTime(time);
-  paraview.Save();
-  paraview_bdr.Save();
+  pv.SetCycle(step);
+  pv.SetTime(time);
+  pv_bdr.SetCycle(step);
+  pv_bdr.SetTime(time);
+  pv.Save();
+  pv_bdr.Save();
   mesh::NondimensionalizeMesh(mesh, mesh_Lc0);
   ScaleGridFunctions(1.0 / mesh_Lc0, mesh.Dimension(), HasImag(), E, B, V, A);
 }
@@ -748,32 +957,33 @@ void PostOperator::WriteFieldsFinal(const ErrorIndicator *indicator) const
   // non-used value to make the step identifiable within the data collection.
   mfem::ParMesh &mesh =
       HasE() ? *E->ParFESpace()->GetParMesh() : *B->ParFESpace()->GetParMesh();
+  auto &pv = *paraview[paraview_idx];
   mesh::DimensionalizeMesh(mesh, mesh_Lc0);
-  paraview.SetCycle(paraview.GetCycle() + 1);
-  if (paraview.GetTime() < 1.0)
+  pv.SetCycle(pv.GetCycle() + 1);
+  if (pv.GetTime() < 1.0)
   {
-    paraview.SetTime(99.0);
+    pv.SetTime(99.0);
   }
   else
   {
     // 1 -> 99, 10 -> 999, etc.
-    paraview.SetTime(
-        std::pow(10.0, 2.0 + static_cast<int>(std::log10(paraview.GetTime()))) - 1.0);
+    pv.SetTime(
+        std::pow(10.0, 2.0 + static_cast<int>(std::log10(pv.GetTime()))) - 1.0);
   }
-  mfem::DataCollection::FieldMapType field_map(paraview.GetFieldMap());  // Copy
+  mfem::DataCollection::FieldMapType field_map(pv.GetFieldMap());  // Copy
   for (const auto &[name, gf] : field_map)
   {
-    paraview.DeregisterField(name);
+    pv.DeregisterField(name);
   }
-  mfem::DataCollection::CoeffFieldMapType coeff_field_map(paraview.GetCoeffFieldMap());
+  mfem::DataCollection::CoeffFieldMapType coeff_field_map(pv.GetCoeffFieldMap());
   for (const auto &[name, gf] : coeff_field_map)
   {
-    paraview.DeregisterCoeffField(name);
+    pv.DeregisterCoeffField(name);
   }
-  mfem::DataCollection::VCoeffFieldMapType vcoeff_field_map(paraview.GetVCoeffFieldMap());
+  mfem::DataCollection::VCoeffFieldMapType vcoeff_field_map(pv.GetVCoeffFieldMap());
   for (const auto &[name, gf] : vcoeff_field_map)
   {
-    paraview.DeregisterVCoeffField(name);
+    pv.DeregisterVCoeffField(name);
   }
   mfem::L2_FECollection pwconst_fec(0, mesh.Dimension());
   mfem::FiniteElementSpace pwconst_fespace(&mesh, &pwconst_fec);
@@ -781,7 +991,7 @@ void PostOperator::WriteFieldsFinal(const ErrorIndicator *indicator) const
   {
     rank = std::make_unique<mfem::GridFunction>(&pwconst_fespace);
     *rank = mesh.GetMyRank() + 1;
-    paraview.RegisterField("Rank", rank.get());
+    pv.RegisterField("Rank", rank.get());
   }
   if (indicator)
   {
@@ -789,28 +999,28 @@ void PostOperator::WriteFieldsFinal(const ErrorIndicator *indicator) const
     MFEM_VERIFY(eta->Size() == indicator->Local().Size(),
                 "Size mismatch for provided ErrorIndicator for postprocessing!");
     *eta = indicator->Local();
-    paraview.RegisterField("Indicator", eta.get());
+    pv.RegisterField("Indicator", eta.get());
   }
-  paraview.Save();
+  pv.Save();
   if (rank)
   {
-    paraview.DeregisterField("Rank");
+    pv.DeregisterField("Rank");
   }
   if (eta)
   {
-    paraview.DeregisterField("Indicator");
+    pv.DeregisterField("Indicator");
   }
   for (const auto &[name, gf] : field_map)
   {
-    paraview.RegisterField(name, gf);
+    pv.RegisterField(name, gf);
   }
   for (const auto &[name, gf] : coeff_field_map)
   {
-    paraview.RegisterCoeffField(name, gf);
+    pv.RegisterCoeffField(name, gf);
   }
   for (const auto &[name, gf] : vcoeff_field_map)
   {
-    paraview.RegisterVCoeffField(name, gf);
+    pv.RegisterVCoeffField(name, gf);
   }
   mesh::NondimensionalizeMesh(mesh, mesh_Lc0);
 }
@@ -818,12 +1028,20 @@ void PostOperator::WriteFieldsFinal(const ErrorIndicator *indicator) const
 std::vector<std::complex<double>> PostOperator::ProbeEField() const
 {
   MFEM_VERIFY(E, "PostOperator is not configured for electric field probes!");
+  if (reduced_init)
+  {
+    return ReducedProbe(reduced->probe_E, reduced->y, 1.0);
+  }
   return interp_op.ProbeField(*E);
 }
 
 std::vector<std::complex<double>> PostOperator::ProbeBField() const
 {
   MFEM_VERIFY(B, "PostOperator is not configured for magnetic flux density probes!");
+  if (reduced_init)
+  {
+    return ReducedProbe(reduced->probe_B, reduced->y, -1.0 / (1i * reduced->omega));
+  }
   return interp_op.ProbeField(*B);
 }
 
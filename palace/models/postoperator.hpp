@@ -9,6 +9,7 @@
 #include <memory>
 #include <string>
 #include <vector>
+#include <Eigen/Dense>
 #include <mfem.hpp>
 #include "fem/gridfunction.hpp"
 #include "fem/interpolator.hpp"
@@ -64,11 +65,30 @@ private:
   std::map<int, PortPostData> lumped_port_vi, wave_port_vi;
   bool lumped_port_init, wave_port_init;
 
-  // Data collection for writing fields to disk for visualization and sampling points.
-  mutable mfem::ParaViewDataCollection paraview, paraview_bdr;
+  // Projections of the postprocessing functionals onto a real-valued reduced basis V, for
+  // postprocessing reduced-order solutions E = V y without expanding them into the
+  // high-dimensional space. The energy matrices for B use the basis ∇ x V, scaled by
+  // 1/ω² when evaluated. The lumped port power is sesquilinear in E and B and is projected
+  // onto pairs of basis vectors.
+  struct ReducedPostData
+  {
+    Eigen::MatrixXd M_elec, M_mag;
+    std::map<int, std::pair<Eigen::MatrixXd, Eigen::MatrixXd>> M_i;
+    std::map<int, std::pair<Eigen::VectorXd, Eigen::VectorXd>> lumped_port_vs;
+    std::map<int, Eigen::MatrixXd> lumped_port_p;
+    Eigen::MatrixXd probe_E, probe_B;
+    Eigen::VectorXcd y;
+    double omega;
+  };
+  std::unique_ptr<ReducedPostData> reduced;
+  bool reduced_init;
+
+  // Data collections for writing fields to disk for visualization (one pair for each output
+  // directory, see AddDataCollection) and sampling points.
+  std::vector<std::unique_ptr<mfem::ParaViewDataCollection>> paraview, paraview_bdr;
+  int paraview_idx;
   mutable InterpolationOperator interp_op;
   double mesh_Lc0;
-  void InitializeDataCollection(const IoData &iodata);
 
 public:
   PostOperator(const IoData &iodata, SpaceOperator &space_op, const std::string &name);
@@ -96,6 +116,17 @@ public:
   void SetVGridFunction(const Vector &v, bool exchange_face_nbr_data = true);
   void SetAGridFunction(const Vector &a, bool exchange_face_nbr_data = true);
 
+  // Set up postprocessing of reduced-order solutions in the span of the real-valued basis
+  // V[0:n), and set the coefficients y of the reduced-order solution at the given
+  // frequency. Setting up the reduced-order postprocessing returns false if any configured
+  // quantities (wave ports or surface postprocessing) require the high-dimensional
+  // solution. Setting the E- and B-field grid functions reverts to postprocessing the
+  // high-dimensional solution.
+  bool SetReducedBasis(const std::vector<Vector> &V, int n, const Operator &Curl,
+                       const LumpedPortOperator &lumped_port_op,
+                       const WavePortOperator &wave_port_op);
+  void SetReducedSolution(const Eigen::VectorXcd &y, double omega);
+
   // Access grid functions for field solutions.
   auto &GetEGridFunction()
   {
@@ -180,6 +211,19 @@ public:
   double GetExternalKappa(const LumpedPortOperator &lumped_port_op, int idx,
                           double E_m) const;
 
+  // Add data collections for writing fields to disk in the output directory of the given
+  // configuration, returning their index. The data collections used for field output are
+  // selected by index, where index 0 is the output directory provided at construction.
+  // This allows several solutions (for example for separate port excitations) to share a
+  // single PostOperator.
+  int AddDataCollection(const IoData &iodata, const std::string &name);
+  void SetDataCollection(int idx)
+  {
+    MFEM_VERIFY(idx >= 0 && idx < static_cast<int>(paraview.size()),
+                "Invalid data collection index for PostOperator field output!");
+    paraview_idx = idx;
+  }
+
   // Write to disk the E- and B-fields extracted from the solution vectors. Note that fields
   // are not redimensionalized, to do so one needs to compute: B <= B * (μ₀ H₀), E <= E *
   // (Z₀ H₀), V <= V * (Z₀ H₀ L₀), etc.
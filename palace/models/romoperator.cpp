@@ -3,11 +3,14 @@
 
 #include "romoperator.hpp"
 
+#include <cstdint>
+#include <fstream>
 #include <Eigen/SVD>
 #include <mfem.hpp>
 #include "linalg/orthog.hpp"
 #include "models/spaceoperator.hpp"
 #include "utils/communication.hpp"
+#include "utils/filesystem.hpp"
 #include "utils/iodata.hpp"
 #include "utils/timer.hpp"
 
@@ -31,6 +34,10 @@ namespace
 
 constexpr auto ORTHOG_TOL = 1.0e-12;
 
+// Identifier and version for the binary PROM file format.
+constexpr std::int64_t ROM_FILE_ID = 0x4d4f525045434c50;  // "PLCEPROM"
+constexpr std::int64_t ROM_FILE_VERSION = 1;
+
 template <typename VecType, typename ScalarType>
 inline void OrthogonalizeColumn(GmresSolverBase::OrthogType type, MPI_Comm comm,
                                 const std::vector<VecType> &V, VecType &w, ScalarType *Rj,
@@ -184,6 +191,29 @@ inline void ProlongatePROMSolution(std::size_t n, const std::vector<Vector> &V,
   }
 }
 
+inline std::string GetROMFilename(std::string path, MPI_Comm comm)
+{
+  // Each process reads and writes its own file, since the basis vectors are distributed.
+  if (!path.empty() && path.back() != '/')
+  {
+    path += '/';
+  }
+  const int width = 1 + static_cast<int>(std::log10(std::max(Mpi::Size(comm) - 1, 1)));
+  return mfem::MakeParFilename(path + "rom.", Mpi::Rank(comm), ".bin", width);
+}
+
+template <typename T>
+inline void WriteBinary(std::ostream &fo, const T *data, std::size_t n)
+{
+  fo.write(reinterpret_cast<const char *>(data), n * sizeof(T));
+}
+
+template <typename T>
+inline void ReadBinary(std::istream &fi, T *data, std::size_t n)
+{
+  fi.read(reinterpret_cast<char *>(data), n * sizeof(T));
+}
+
 }  // namespace
 
 RomOperator::RomOperator(const IoData &iodata, SpaceOperator &space_op, int max_size)
@@ -198,6 +228,12 @@ RomOperator::RomOperator(const IoData &iodata, SpaceOperator &space_op, int max_
   M = space_op.GetMassMatrix<ComplexOperator>(Operator::DIAG_ZERO);
   MFEM_VERIFY(K && M, "Invalid empty HDM matrices when constructing PROM!");
 
+  // The frequency-dependent boundary contributions are decomposed into a sum of frequency-
+  // independent operators with scalar coefficients, so that they can be projected once per
+  // basis update rather than at every frequency in the online phase.
+  A2j = space_op.GetExtraSystemMatrixTerms<ComplexOperator>(Operator::DIAG_ZERO);
+  A2jr.resize(A2j.size());
+
   // Set up RHS vector (linear in frequency part) for the incident field at port boundaries,
   // and the vector for the solution, which satisfies the Dirichlet (PEC) BC.
   has_RHS1 = space_op.GetExcitationVector1(RHS1);
@@ -205,7 +241,7 @@ RomOperator::RomOperator(const IoData &iodata, SpaceOperator &space_op, int max_
   {
     RHS1.SetSize(0);
   }
-  has_A2 = has_RHS2 = true;
+  has_RHS2 = true;
 
   // Initialize working vector storage.
   r.SetSize(K->Height());
@@ -217,6 +253,8 @@ RomOperator::RomOperator(const IoData &iodata, SpaceOperator &space_op, int max_
   // matrix.
   ksp = std::make_unique<ComplexKspSolver>(iodata, space_op.GetNDSpaces(),
                                            &space_op.GetH1Spaces());
+  ksp_tol = iodata.solver.linear.tol;
+  ksp_initial_guess = iodata.solver.linear.initial_guess;
 
   // The initial PROM basis is empty. The provided maximum dimension is the number of sample
   // points (2 basis vectors per point). Basis orthogonalization method is configured using
@@ -239,18 +277,151 @@ RomOperator::RomOperator(const IoData &iodata, SpaceOperator &space_op, int max_
   }
 }
 
-void RomOperator::SolveHDM(double omega, ComplexVector &u)
+RomOperator::RomOperator(SpaceOperator &space_op, const std::string &path)
+  : space_op(space_op)
+{
+  // Read the reduced-order model written by a previous offline phase. The basis vectors
+  // are distributed, so the file must have been written with the same number of processes
+  // and the same mesh partitioning.
+  BlockTimer bt(Timer::IO);
+  MPI_Comm comm = space_op.GetComm();
+  const std::string filename = GetROMFilename(path, comm);
+  std::ifstream fi(filename, std::ios::binary);
+  MFEM_VERIFY(fi.good(), "Unable to open PROM file " << filename << "!");
+  std::int64_t header[9];
+  ReadBinary(fi, header, 9);
+  MFEM_VERIFY(fi.good() && header[0] == ROM_FILE_ID && header[1] == ROM_FILE_VERSION,
+              "Invalid or unsupported PROM file " << filename << "!");
+  MFEM_VERIFY(header[2] == Mpi::Size(comm) &&
+                  header[3] == space_op.GetNDSpace().GetTrueVSize(),
+              "PROM file " << filename << " was written for " << header[2]
+                           << " processes and local size " << header[3]
+                           << ", but the current model has " << Mpi::Size(comm)
+                           << " processes and local size "
+                           << space_op.GetNDSpace().GetTrueVSize() << "!");
+  dim_V = header[4];
+  dim_Q = header[5];
+  const bool has_C = header[6], has_A2 = header[7];
+  has_RHS1 = header[8];
+  has_RHS2 = true;
+  if (has_A2)
+  {
+    std::int64_t n_A2;
+    ReadBinary(fi, &n_A2, 1);
+    A2jr.resize(n_A2);
+  }
+
+  // Read the PROM matrices and vectors, the MRI data, and the local part of the basis.
+  auto ReadMatrix = [&fi](Eigen::MatrixXcd &Ar, std::size_t m, std::size_t n)
+  {
+    Ar.resize(m, n);
+    ReadBinary(fi, Ar.data(), m * n);
+  };
+  ReadMatrix(Kr, dim_V, dim_V);
+  if (has_C)
+  {
+    ReadMatrix(Cr, dim_V, dim_V);
+  }
+  ReadMatrix(Mr, dim_V, dim_V);
+  for (auto &A2r : A2jr)
+  {
+    ReadMatrix(A2r, dim_V, dim_V);
+  }
+  if (has_RHS1)
+  {
+    RHS1r.resize(dim_V);
+    ReadBinary(fi, RHS1r.data(), dim_V);
+  }
+  ReadMatrix(R, dim_Q, dim_Q);
+  q.resize(dim_Q);
+  ReadBinary(fi, q.data(), dim_Q);
+  z.resize(dim_Q);
+  ReadBinary(fi, z.data(), dim_Q);
+  V.resize(dim_V, Vector());
+  for (auto &v : V)
+  {
+    v.SetSize(header[3]);
+    v.UseDevice(true);
+    ReadBinary(fi, v.HostWrite(), v.Size());
+  }
+  MFEM_VERIFY(fi.good(), "Failed to read PROM file " << filename << "!");
+  Ar.resize(dim_V, dim_V);
+  RHSr.resize(dim_V);
+  ksp_tol = 0.0;
+  ksp_initial_guess = false;
+  orthog_type = GmresSolverBase::OrthogType::MGS;
+}
+
+void RomOperator::SaveROM(const std::string &path) const
+{
+  BlockTimer bt(Timer::IO);
+  MPI_Comm comm = space_op.GetComm();
+  if (Mpi::Root(comm) && !std::filesystem::exists(path))
+  {
+    std::filesystem::create_directories(path);
+  }
+  Mpi::Barrier(comm);
+  const std::string filename = GetROMFilename(path, comm);
+  std::ofstream fo(filename, std::ios::binary | std::ios::trunc);
+  MFEM_VERIFY(fo.good(), "Unable to open PROM file " << filename << " for writing!");
+  const std::int64_t local_size = dim_V > 0 ? V[0].Size() : K->Height();
+  const std::int64_t header[9] = {ROM_FILE_ID,
+                                  ROM_FILE_VERSION,
+                                  Mpi::Size(comm),
+                                  local_size,
+                                  static_cast<std::int64_t>(dim_V),
+                                  static_cast<std::int64_t>(dim_Q),
+                                  Cr.size() > 0,
+                                  !A2jr.empty(),
+                                  has_RHS1};
+  WriteBinary(fo, header, 9);
+  if (!A2jr.empty())
+  {
+    const std::int64_t n_A2 = A2jr.size();
+    WriteBinary(fo, &n_A2, 1);
+  }
+  WriteBinary(fo, Kr.data(), Kr.size());
+  WriteBinary(fo, Cr.data(), Cr.size());
+  WriteBinary(fo, Mr.data(), Mr.size());
+  for (const auto &A2r : A2jr)
+  {
+    WriteBinary(fo, A2r.data(), A2r.size());
+  }
+  if (has_RHS1)
+  {
+    WriteBinary(fo, RHS1r.data(), RHS1r.size());
+  }
+  WriteBinary(fo, R.data(), R.size());
+  WriteBinary(fo, q.data(), q.size());
+  WriteBinary(fo, z.data(), z.size());
+  for (std::size_t j = 0; j < dim_V; j++)
+  {
+    WriteBinary(fo, V[j].HostRead(), V[j].Size());
+  }
+  MFEM_VERIFY(fo.good(), "Failed to write PROM file " << filename << "!");
+}
+
+void RomOperator::SolveHDM(double omega, ComplexVector &u, bool reuse_pc,
+                           bool initial_guess, double tol)
 {
+  MFEM_VERIFY(K && M && ksp, "HDM solve is not available for a PROM loaded from disk!");
   // Compute HDM solution at the given frequency. The system matrix, A = K + iω C - ω² M +
-  // A2(ω) is built by summing the underlying operator contributions.
+  // A2(ω) is built by summing the underlying operator contributions. The preconditioner
+  // from the previous HDM solve is optionally kept.
   A2 = space_op.GetExtraSystemMatrix<ComplexOperator>(omega, Operator::DIAG_ZERO);
-  has_A2 = (A2 != nullptr);
-  auto A = space_op.GetSystemMatrix(std::complex<double>(1.0, 0.0), 1i * omega,
-                                    std::complex<double>(-omega * omega, 0.0), K.get(),
-                                    C.get(), M.get(), A2.get());
-  auto P =
-      space_op.GetPreconditionerMatrix<ComplexOperator>(1.0, omega, -omega * omega, omega);
-  ksp->SetOperators(*A, *P);
+  A = space_op.GetSystemMatrix(std::complex<double>(1.0, 0.0), 1i * omega,
+                               std::complex<double>(-omega * omega, 0.0), K.get(), C.get(),
+                               M.get(), A2.get());
+  if (reuse_pc && P)
+  {
+    ksp->SetOperator(*A);
+  }
+  else
+  {
+    P = space_op.GetPreconditionerMatrix<ComplexOperator>(1.0, omega, -omega * omega,
+                                                          omega);
+    ksp->SetOperators(*A, *P);
+  }
 
   // The HDM excitation vector is computed as RHS = iω RHS1 + RHS2(ω).
   Mpi::Print("\n");
@@ -267,39 +438,55 @@ void RomOperator::SolveHDM(double omega, ComplexVector &u)
     r.Add(1i * omega, RHS1);
   }
 
-  // Solve the linear system.
+  // Solve the linear system. For an initial guess, the linear solver tolerance is relative
+  // to the norm of the RHS rather than the initial residual.
+  ksp->SetInitialGuess(initial_guess || ksp_initial_guess);
+  ksp->SetRelTol(std::max(tol, ksp_tol));
+  if (tol > ksp_tol)
+  {
+    Mpi::Print(" Inexact HDM solve with relative tolerance {:.3e}\n", tol);
+  }
   ksp->Mult(r, u);
 }
 
-void RomOperator::UpdatePROM(double omega, const ComplexVector &u)
+void RomOperator::UpdatePROM(const std::vector<double> &omega,
+                             const std::vector<ComplexVector> &u)
 {
   // Update V. The basis is always real (each complex solution adds two basis vectors if it
-  // has a nonzero real and imaginary parts).
+  // has a nonzero real and imaginary parts). A batch of solutions is orthogonalized into
+  // the basis before the reduced-order operators are updated at once.
   BlockTimer bt(Timer::CONSTRUCT_PROM);
+  MFEM_VERIFY(K && M, "PROM update is not available for a PROM loaded from disk!");
+  MFEM_VERIFY(omega.size() == u.size(),
+              "Mismatch in number of frequencies and solutions for PROM update!");
   MPI_Comm comm = space_op.GetComm();
-  const double normr = linalg::Norml2(comm, u.Real());
-  const double normi = linalg::Norml2(comm, u.Imag());
-  const bool has_real = (normr > ORTHOG_TOL * std::sqrt(normr * normr + normi * normi));
-  const bool has_imag = (normi > ORTHOG_TOL * std::sqrt(normr * normr + normi * normi));
-  MFEM_VERIFY(dim_V + has_real + has_imag <= V.size(),
-              "Unable to increase basis storage size, increase maximum number of vectors!");
   const std::size_t dim_V0 = dim_V;
-  std::vector<double> H(dim_V + has_real + has_imag);
-  if (has_real)
+  for (const auto &uk : u)
   {
-    V[dim_V] = u.Real();
-    OrthogonalizeColumn(orthog_type, comm, V, V[dim_V], H.data(), dim_V);
-    H[dim_V] = linalg::Norml2(comm, V[dim_V]);
-    V[dim_V] *= 1.0 / H[dim_V];
-    dim_V++;
-  }
-  if (has_imag)
-  {
-    V[dim_V] = u.Imag();
-    OrthogonalizeColumn(orthog_type, comm, V, V[dim_V], H.data(), dim_V);
-    H[dim_V] = linalg::Norml2(comm, V[dim_V]);
-    V[dim_V] *= 1.0 / H[dim_V];
-    dim_V++;
+    const double normr = linalg::Norml2(comm, uk.Real());
+    const double normi = linalg::Norml2(comm, uk.Imag());
+    const bool has_real = (normr > ORTHOG_TOL * std::sqrt(normr * normr + normi * normi));
+    const bool has_imag = (normi > ORTHOG_TOL * std::sqrt(normr * normr + normi * normi));
+    MFEM_VERIFY(
+        dim_V + has_real + has_imag <= V.size(),
+        "Unable to increase basis storage size, increase maximum number of vectors!");
+    std::vector<double> H(dim_V + has_real + has_imag);
+    if (has_real)
+    {
+      V[dim_V] = uk.Real();
+      OrthogonalizeColumn(orthog_type, comm, V, V[dim_V], H.data(), dim_V);
+      H[dim_V] = linalg::Norml2(comm, V[dim_V]);
+      V[dim_V] *= 1.0 / H[dim_V];
+      dim_V++;
+    }
+    if (has_imag)
+    {
+      V[dim_V] = uk.Imag();
+      OrthogonalizeColumn(orthog_type, comm, V, V[dim_V], H.data(), dim_V);
+      H[dim_V] = linalg::Norml2(comm, V[dim_V]);
+      V[dim_V] *= 1.0 / H[dim_V];
+      dim_V++;
+    }
   }
 
   // Update reduced-order operators. Resize preserves the upper dim0 x dim0 block of each
@@ -314,6 +501,11 @@ void RomOperator::UpdatePROM(double omega, const ComplexVector &u)
   }
   Mr.conservativeResize(dim_V, dim_V);
   ProjectMatInternal(comm, V, *M, Mr, r, dim_V0);
+  for (std::size_t j = 0; j < A2j.size(); j++)
+  {
+    A2jr[j].conservativeResize(dim_V, dim_V);
+    ProjectMatInternal(comm, V, *A2j[j], A2jr[j], r, dim_V0);
+  }
   Ar.resize(dim_V, dim_V);
   if (RHS1.Size())
   {
@@ -325,20 +517,24 @@ void RomOperator::UpdatePROM(double omega, const ComplexVector &u)
   // Compute the coefficients for the minimal rational interpolation of the state u used
   // as an error indicator. The complex-valued snapshot matrix U = [{u_i, (iω) u_i}] is
   // stored by its QR decomposition.
-  MFEM_VERIFY(dim_Q + 1 <= Q.size(),
+  MFEM_VERIFY(dim_Q + u.size() <= Q.size(),
               "Unable to increase basis storage size, increase maximum number of vectors!");
-  R.conservativeResizeLike(Eigen::MatrixXd::Zero(dim_Q + 1, dim_Q + 1));
-  {
-    std::vector<const ComplexVector *> blocks = {&u, &u};
-    std::vector<std::complex<double>> s = {1.0, 1i * omega};
-    Q[dim_Q].SetSize(2 * u.Size());
-    Q[dim_Q].UseDevice(true);
-    Q[dim_Q].SetBlocks(blocks, s);
-  }
-  OrthogonalizeColumn(orthog_type, comm, Q, Q[dim_Q], R.col(dim_Q).data(), dim_Q);
-  R(dim_Q, dim_Q) = linalg::Norml2(comm, Q[dim_Q]);
-  Q[dim_Q] *= 1.0 / R(dim_Q, dim_Q);
-  dim_Q++;
+  R.conservativeResizeLike(Eigen::MatrixXd::Zero(dim_Q + u.size(), dim_Q + u.size()));
+  for (std::size_t k = 0; k < u.size(); k++)
+  {
+    {
+      std::vector<const ComplexVector *> blocks = {&u[k], &u[k]};
+      std::vector<std::complex<double>> s = {1.0, 1i * omega[k]};
+      Q[dim_Q].SetSize(2 * u[k].Size());
+      Q[dim_Q].UseDevice(true);
+      Q[dim_Q].SetBlocks(blocks, s);
+    }
+    OrthogonalizeColumn(orthog_type, comm, Q, Q[dim_Q], R.col(dim_Q).data(), dim_Q);
+    R(dim_Q, dim_Q) = linalg::Norml2(comm, Q[dim_Q]);
+    Q[dim_Q] *= 1.0 / R(dim_Q, dim_Q);
+    dim_Q++;
+    z.push_back(omega[k]);
+  }
   ComputeMRI(R, q);
   // if (Mpi::Root(comm))
   // {
@@ -346,26 +542,32 @@ void RomOperator::UpdatePROM(double omega, const ComplexVector &u)
   //   std::cout << "R =\n" << R << "\n";
   //   std::cout << "q =\n" << q << "\n";
   // }
-  z.push_back(omega);
 }
 
 void RomOperator::SolvePROM(double omega, ComplexVector &u)
+{
+  SolvePROM(omega, RHSr);
+  ProlongatePROMSolution(dim_V, V, RHSr, u);
+}
+
+void RomOperator::SolvePROM(double omega, Eigen::VectorXcd &y)
 {
   // Assemble the PROM linear system at the given frequency. The PROM system is defined by
-  // the matrix Aᵣ(ω) = Kᵣ + iω Cᵣ - ω² Mᵣ + Vᴴ A2 V(ω) and source vector RHSᵣ(ω) =
-  // iω RHS1ᵣ + Vᴴ RHS2(ω). A2(ω) and RHS2(ω) are constructed only if required and are
-  // only nonzero on boundaries, will be empty if not needed.
-  if (has_A2)
+  // the matrix Aᵣ(ω) = Kᵣ + iω Cᵣ - ω² Mᵣ + Σⱼ cⱼ(ω) Vᴴ A2ⱼ V and source vector RHSᵣ(ω) =
+  // iω RHS1ᵣ + Vᴴ RHS2(ω). The A2ⱼ and RHS2(ω) are only nonzero on boundaries, and will be
+  // empty if not needed.
+  Ar = Kr;
+  if (!A2jr.empty())
   {
-    A2 = space_op.GetExtraSystemMatrix<ComplexOperator>(omega, Operator::DIAG_ZERO);
-    ProjectMatInternal(space_op.GetComm(), V, *A2, Ar, r, 0);
-  }
-  else
-  {
-    Ar.setZero();
+    const auto coeff = space_op.GetExtraSystemMatrixCoefficients(omega);
+    MFEM_VERIFY(coeff.size() == A2jr.size(),
+                "Mismatch in extra system matrix terms and coefficients for PROM!");
+    for (std::size_t j = 0; j < A2jr.size(); j++)
+    {
+      Ar += coeff[j] * A2jr[j];
+    }
   }
-  Ar += Kr;
-  if (C)
+  if (Cr.size() > 0)
   {
     Ar += (1i * omega) * Cr;
   }
@@ -385,22 +587,20 @@ void RomOperator::SolvePROM(double omega, ComplexVector &u)
     RHSr += (1i * omega) * RHS1r;
   }
 
-  // Compute PROM solution at the given frequency and expand into high-dimensional space.
-  // The PROM is solved on every process so the matrix-vector product for vector expansion
-  // does not require communication.
+  // Compute PROM solution at the given frequency. The PROM is solved on every process so
+  // the matrix-vector product for vector expansion does not require communication.
   BlockTimer bt(Timer::SOLVE_PROM);
   if constexpr (false)
   {
     // LDLT solve
-    RHSr = Ar.ldlt().solve(RHSr);
-    RHSr = Ar.selfadjointView<Eigen::Lower>().ldlt().solve(RHSr);
+    y = Ar.ldlt().solve(RHSr);
+    y = Ar.selfadjointView<Eigen::Lower>().ldlt().solve(RHSr);
   }
   else
   {
     // LU solve
-    RHSr = Ar.partialPivLu().solve(RHSr);
+    y = Ar.partialPivLu().solve(RHSr);
   }
-  ProlongatePROMSolution(dim_V, V, RHSr, u);
 }
 
 std::vector<double> RomOperator::FindMaxError(int N) const
@@ -459,32 +659,52 @@ std::vector<double> RomOperator::FindMaxError(int N) const
   //   }
   // }
 
-  // Fall back to sampling Q on discrete points if no roots exist in [start, end].
-  if (std::abs(z_star[0]) == 0.0)
+  // Fall back to sampling Q on discrete points if no roots exist in [start, end]. The local
+  // minima of |Q| are collected in order to return distinct points for N > 1.
+  if (N > 0 && std::abs(z_star[0]) == 0.0)
   {
-    const auto delta = (end - start) / 1.0e6;
     std::vector<double> Q_star(N, mfem::infinity());
-    while (start <= end)
+    auto InsertMin = [&](double x, double Q)
     {
-      const double Q = std::abs((q.array() / (z_map.array() - start)).sum());
       for (int i = 0; i < N; i++)
       {
         if (Q < Q_star[i])
         {
-          for (int j = i + 1; j < N; j++)
+          for (int j = N - 1; j > i; j--)
           {
             z_star[j] = z_star[j - 1];
             Q_star[j] = Q_star[j - 1];
           }
-          z_star[i] = start;
+          z_star[i] = x;
           Q_star[i] = Q;
+          break;
         }
       }
-      start += delta;
+    };
+    const auto delta = (end - start) / 1.0e6;
+    double Q_prev = mfem::infinity(), Q_prev2 = mfem::infinity();
+    double x = start;
+    while (x <= end)
+    {
+      const double Q = std::abs((q.array() / (z_map.array() - x)).sum());
+      if (Q_prev < Q_prev2 && Q_prev <= Q)
+      {
+        InsertMin(x - delta, Q_prev);
+      }
+      Q_prev2 = Q_prev;
+      Q_prev = Q;
+      x += delta;
+    }
+    if (Q_prev < Q_prev2)
+    {
+      InsertMin(x - delta, Q_prev);
+    }
+    MFEM_VERIFY(std::abs(z_star[0]) > 0.0, "Could not locate a maximum error in the range ["
+                                               << start << ", " << end << "]!");
+    while (std::abs(z_star.back()) == 0.0)
+    {
+      z_star.pop_back();
     }
-    MFEM_VERIFY(N == 0 || std::abs(z_star[0]) > 0.0,
-                "Could not locate a maximum error in the range [" << start << ", " << end
-                                                                  << "]!");
   }
   std::vector<double> vals(z_star.size());
   std::transform(z_star.begin(), z_star.end(), vals.begin(),
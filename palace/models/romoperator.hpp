@@ -4,8 +4,10 @@
 #ifndef PALACE_MODELS_ROM_OPERATOR_HPP
 #define PALACE_MODELS_ROM_OPERATOR_HPP
 
+#include <algorithm>
 #include <complex>
 #include <memory>
+#include <string>
 #include <vector>
 #include <Eigen/Dense>
 #include "linalg/ksp.hpp"
@@ -28,16 +30,25 @@ private:
   // Reference to HDM discretization (not owned).
   SpaceOperator &space_op;
 
-  // HDM system matrices and excitation RHS.
+  // HDM system matrices and excitation RHS. The frequency-dependent A2(ω) is decomposed as
+  // Σⱼ cⱼ(ω) A2ⱼ for the PROM.
   std::unique_ptr<ComplexOperator> K, M, C, A2;
+  std::vector<std::unique_ptr<ComplexOperator>> A2j;
   ComplexVector RHS1, RHS2, r;
-  bool has_A2, has_RHS1, has_RHS2;
+  bool has_RHS1, has_RHS2;
 
-  // HDM linear system solver and preconditioner.
+  // HDM linear system solver and preconditioner, with the system and preconditioner
+  // matrices for the most recent HDM solve.
   std::unique_ptr<ComplexKspSolver> ksp;
+  std::unique_ptr<ComplexOperator> A, P;
+
+  // Configured linear solver tolerance and initial guess option for HDM solves.
+  double ksp_tol;
+  bool ksp_initial_guess;
 
   // PROM matrices and vectors.
   Eigen::MatrixXcd Kr, Mr, Cr, Ar;
+  std::vector<Eigen::MatrixXcd> A2jr;
   Eigen::VectorXcd RHS1r, RHSr;
 
   // PROM reduced-order basis (real-valued) and active dimension.
@@ -57,8 +68,13 @@ private:
 public:
   RomOperator(const IoData &iodata, SpaceOperator &space_op, int max_size);
 
-  // Return the HDM linear solver.
-  const ComplexKspSolver &GetLinearSolver() const { return *ksp; }
+  // Construct the PROM from a reduced-order model previously written to disk using SaveROM.
+  // The HDM system matrices and linear solver are not constructed, so only the online phase
+  // (SolvePROM) is available.
+  RomOperator(SpaceOperator &space_op, const std::string &path);
+
+  // Return the HDM linear solver (nullptr if the PROM was loaded from disk).
+  const ComplexKspSolver *GetLinearSolver() const { return ksp.get(); }
 
   // Return PROM dimension.
   int GetReducedDimension() const { return dim_V; }
@@ -66,20 +82,44 @@ public:
   // Return set of sampled parameter points for basis construction.
   const auto &GetSamplePoints() const { return z; }
 
-  // Assemble and solve the HDM at the specified frequency.
-  void SolveHDM(double omega, ComplexVector &u);
-
-  // Add the solution vector to the reduced-order basis and update the PROM.
-  void UpdatePROM(double omega, const ComplexVector &u);
+  // Return the (real-valued) reduced-order basis, with GetReducedDimension() active
+  // vectors.
+  const auto &GetReducedBasis() const { return V; }
+
+  // Assemble and solve the HDM at the specified frequency, optionally reusing the
+  // preconditioner from the previous HDM solve. The input u is used as the initial guess
+  // for the linear solver if requested, and the solve can be made inexact by specifying a
+  // relative tolerance larger than the configured linear solver tolerance.
+  void SolveHDM(double omega, ComplexVector &u, bool reuse_pc = false,
+                bool initial_guess = false, double tol = 0.0);
+
+  // Relative tolerance for an inexact HDM solve in a greedy iteration, given the largest
+  // PROM error estimate of the previous iteration: the factor times the error, capped at
+  // max_tol and floored at the linear solver tolerance ksp_tol. Without a previous error
+  // estimate or for a zero factor, the HDM solve is exact (ksp_tol).
+  static double GetInexactTolerance(double factor, double error, double ksp_tol,
+                                    double max_tol)
+  {
+    return std::max(ksp_tol, std::min(factor * error, max_tol));
+  }
+
+  // Add the solution vector(s) to the reduced-order basis and update the PROM.
+  void UpdatePROM(const std::vector<double> &omega, const std::vector<ComplexVector> &u);
 
   // Assemble and solve the PROM at the specified frequency, expanding the solution back
-  // into the high-dimensional space.
+  // into the high-dimensional space or returning the reduced-order solution coefficients.
   void SolvePROM(double omega, ComplexVector &u);
+  void SolvePROM(double omega, Eigen::VectorXcd &y);
 
   // Compute the location(s) of the maximum error in the range of the previously sampled
-  // parameter points.
+  // parameter points. Up to N distinct local maxima of the error estimate are returned, in
+  // order of decreasing error.
   std::vector<double> FindMaxError(int N = 1) const;
 
+  // Write the PROM matrices, vectors, and reduced-order basis to disk, with one binary file
+  // per process in the given directory.
+  void SaveROM(const std::string &path) const;
+
   // Compute eigenvalue estimates for the current PROM system.
   std::vector<std::complex<double>> ComputeEigenvalueEstimates() const;
 };
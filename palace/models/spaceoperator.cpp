@@ -442,6 +442,49 @@ SpaceOperator::GetExtraSystemMatrix(double omega, Operator::DiagonalPolicy diag_
   }
 }
 
+template <typename OperType>
+std::vector<std::unique_ptr<OperType>>
+SpaceOperator::GetExtraSystemMatrixTerms(Operator::DiagonalPolicy diag_policy)
+{
+  // The terms are added in the same order as the coefficients in
+  // GetExtraSystemMatrixCoefficients.
+  std::vector<MaterialPropertyCoefficient> dfb, fb;
+  farfield_op.AddExtraSystemBdrTerms(dfb, fb);
+  surf_sigma_op.AddExtraSystemBdrTerms(dfb, fb);
+  wave_port_op.AddExtraSystemBdrTerms(dfb, fb);
+  MFEM_VERIFY(dfb.size() == fb.size(),
+              "Mismatch in extra system matrix boundary terms for decomposition!");
+  constexpr bool skip_zeros = false;
+  std::vector<std::unique_ptr<OperType>> A(dfb.size());
+  for (std::size_t j = 0; j < A.size(); j++)
+  {
+    auto a = AssembleOperator(GetNDSpace(), nullptr, nullptr, &dfb[j], &fb[j], skip_zeros);
+    if constexpr (std::is_same<OperType, ComplexOperator>::value)
+    {
+      auto A_j = std::make_unique<ComplexParOperator>(std::move(a), nullptr, GetNDSpace());
+      A_j->SetEssentialTrueDofs(nd_dbc_tdof_lists.back(), diag_policy);
+      A[j] = std::move(A_j);
+    }
+    else
+    {
+      auto A_j = std::make_unique<ParOperator>(std::move(a), GetNDSpace());
+      A_j->SetEssentialTrueDofs(nd_dbc_tdof_lists.back(), diag_policy);
+      A[j] = std::move(A_j);
+    }
+  }
+  return A;
+}
+
+std::vector<std::complex<double>>
+SpaceOperator::GetExtraSystemMatrixCoefficients(double omega)
+{
+  std::vector<std::complex<double>> coeff;
+  farfield_op.AddExtraSystemCoefficients(omega, coeff);
+  surf_sigma_op.AddExtraSystemCoefficients(omega, coeff);
+  wave_port_op.AddExtraSystemCoefficients(omega, coeff);
+  return coeff;
+}
+
 namespace
 {
 
@@ -1034,6 +1077,11 @@ SpaceOperator::GetExtraSystemMatrix(double, Operator::DiagonalPolicy);
 template std::unique_ptr<ComplexOperator>
 SpaceOperator::GetExtraSystemMatrix(double, Operator::DiagonalPolicy);
 
+template std::vector<std::unique_ptr<Operator>>
+    SpaceOperator::GetExtraSystemMatrixTerms(Operator::DiagonalPolicy);
+template std::vector<std::unique_ptr<ComplexOperator>>
+    SpaceOperator::GetExtraSystemMatrixTerms(Operator::DiagonalPolicy);
+
 template std::unique_ptr<Operator>
 SpaceOperator::GetSystemMatrix<Operator, double>(double, double, double, const Operator *,
                                                  const Operator *, const Operator *,
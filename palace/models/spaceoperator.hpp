@@ -149,6 +149,15 @@ public:
   std::unique_ptr<OperType> GetExtraSystemMatrix(double omega,
                                                  Operator::DiagonalPolicy diag_policy);
 
+  // Construct the frequency-independent operators A2ⱼ and evaluate the scalar coefficients
+  // cⱼ(ω) for the decomposition A2(ω) = Σⱼ cⱼ(ω) A2ⱼ. Evaluating the coefficients for wave
+  // ports requires computing the port modes at the given frequency, but not any assembly
+  // on the full mesh.
+  template <typename OperType>
+  std::vector<std::unique_ptr<OperType>>
+  GetExtraSystemMatrixTerms(Operator::DiagonalPolicy diag_policy);
+  std::vector<std::complex<double>> GetExtraSystemMatrixCoefficients(double omega);
+
   // Construct the complete frequency or time domain system matrix using the provided
   // stiffness, damping, mass, and extra matrices:
   //                     A = a0 K + a1 C + a2 (Mr + i Mi) + A2 .
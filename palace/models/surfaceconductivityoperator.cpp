@@ -150,34 +150,70 @@ mfem::Array<int> SurfaceConductivityOperator::GetAttrList() const
   return attr_list;
 }
 
-void SurfaceConductivityOperator::AddExtraSystemBdrCoefficients(
-    double omega, MaterialPropertyCoefficient &fbr, MaterialPropertyCoefficient &fbi)
+std::complex<double>
+SurfaceConductivityOperator::GetBoundaryCoefficient(const ConductivityData &bdr,
+                                                    double omega) const
 {
   // If the provided conductor thickness is empty (zero), prescribe a surface impedance
   // (1+i)/σδ, where δ is the skin depth. If it is nonzero, use a finite thickness
   // modification which correctly produces the DC limit when h << δ. See the Ansys HFSS
   // user manual section titled "Surface Impedance Boundary Condition for Metal Traces of
   // Finite Thickness."
+  double delta = std::sqrt(2.0 / (bdr.mu * bdr.sigma * omega));
+  std::complex<double> Z = 1.0 / (bdr.sigma * delta);
+  Z.imag(Z.real());
+  if (bdr.h > 0.0)
+  {
+    double nu = bdr.h / delta;
+    double den = std::cosh(nu) - std::cos(nu);
+    Z.real(Z.real() * (std::sinh(nu) + std::sin(nu)) / den);
+    Z.imag(Z.imag() * (std::sinh(nu) - std::sin(nu)) / den);
+  }
+  // The BC term has coefficient iω/Z (like for standard lumped surface impedance).
+  return 1i * omega / Z;
+}
+
+void SurfaceConductivityOperator::AddExtraSystemBdrCoefficients(
+    double omega, MaterialPropertyCoefficient &fbr, MaterialPropertyCoefficient &fbi)
+{
   for (const auto &bdr : boundaries)
   {
     if (std::abs(bdr.sigma) > 0.0)
     {
-      double delta = std::sqrt(2.0 / (bdr.mu * bdr.sigma * omega));
-      std::complex<double> Z = 1.0 / (bdr.sigma * delta);
-      Z.imag(Z.real());
-      if (bdr.h > 0.0)
-      {
-        double nu = bdr.h / delta;
-        double den = std::cosh(nu) - std::cos(nu);
-        Z.real(Z.real() * (std::sinh(nu) + std::sin(nu)) / den);
-        Z.imag(Z.imag() * (std::sinh(nu) - std::sin(nu)) / den);
-      }
-      // The BC term has coefficient iω/Z (like for standard lumped surface impedance).
-      std::complex<double> s(1i * omega / Z);
+      std::complex<double> s = GetBoundaryCoefficient(bdr, omega);
       fbr.AddMaterialProperty(mat_op.GetCeedBdrAttributes(bdr.attr_list), s.real());
       fbi.AddMaterialProperty(mat_op.GetCeedBdrAttributes(bdr.attr_list), s.imag());
     }
   }
 }
 
+void SurfaceConductivityOperator::AddExtraSystemBdrTerms(
+    std::vector<MaterialPropertyCoefficient> &dfb,
+    std::vector<MaterialPropertyCoefficient> &fb)
+{
+  // Each finite conductivity boundary contributes a boundary mass term with coefficient
+  // iω/Z(ω).
+  for (const auto &bdr : boundaries)
+  {
+    if (std::abs(bdr.sigma) > 0.0)
+    {
+      dfb.emplace_back(mat_op.MaxCeedBdrAttribute());
+      fb.emplace_back(mat_op.MaxCeedBdrAttribute())
+          .AddMaterialProperty(mat_op.GetCeedBdrAttributes(bdr.attr_list), 1.0);
+    }
+  }
+}
+
+void SurfaceConductivityOperator::AddExtraSystemCoefficients(
+    double omega, std::vector<std::complex<double>> &coeff)
+{
+  for (const auto &bdr : boundaries)
+  {
+    if (std::abs(bdr.sigma) > 0.0)
+    {
+      coeff.push_back(GetBoundaryCoefficient(bdr, omega));
+    }
+  }
+}
+
 }  // namespace palace
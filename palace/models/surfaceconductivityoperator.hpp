@@ -4,6 +4,7 @@
 #ifndef PALACE_MODELS_SURFACE_CONDUCTIVITY_OPERATOR_HPP
 #define PALACE_MODELS_SURFACE_CONDUCTIVITY_OPERATOR_HPP
 
+#include <complex>
 #include <vector>
 #include <mfem.hpp>
 
@@ -35,6 +36,9 @@ private:
   void SetUpBoundaryProperties(const IoData &iodata, const mfem::ParMesh &mesh);
   void PrintBoundaryInfo(const IoData &iodata, const mfem::ParMesh &mesh);
 
+  std::complex<double> GetBoundaryCoefficient(const ConductivityData &bdr,
+                                              double omega) const;
+
 public:
   SurfaceConductivityOperator(const IoData &iodata, const MaterialOperator &mat_op,
                               const mfem::ParMesh &mesh);
@@ -45,6 +49,12 @@ public:
   // Add contributions to system matrix for a finite conductivity boundary condition.
   void AddExtraSystemBdrCoefficients(double omega, MaterialPropertyCoefficient &fbr,
                                      MaterialPropertyCoefficient &fbi);
+
+  // Add the frequency-independent terms of the extra system matrix contributions, one per
+  // entry of dfb and fb, and the corresponding frequency-dependent scalar coefficients.
+  void AddExtraSystemBdrTerms(std::vector<MaterialPropertyCoefficient> &dfb,
+                              std::vector<MaterialPropertyCoefficient> &fb);
+  void AddExtraSystemCoefficients(double omega, std::vector<std::complex<double>> &coeff);
 };
 
 }  // namespace palace
@@ -514,6 +514,18 @@ public:
   }
 };
 
+void AddPortBdrCoefficients(const WavePortData &data, double coeff,
+                            MaterialPropertyCoefficient &fb)
+{
+  // Boundary mass term with coefficient μ⁻¹ on the port boundary.
+  const MaterialOperator &mat_op = data.mat_op;
+  MaterialPropertyCoefficient muinv_func(mat_op.GetBdrAttributeToMaterial(),
+                                         mat_op.GetInvPermeability());
+  muinv_func.RestrictCoefficient(mat_op.GetCeedBdrAttributes(data.GetAttrList()));
+  fb.AddCoefficient(muinv_func.GetAttributeToMaterial(), muinv_func.GetMaterialProperties(),
+                    coeff);
+}
+
 }  // namespace
 
 WavePortData::WavePortData(const config::WavePortData &data,
@@ -1223,6 +1235,13 @@ const WavePortData &WavePortOperator::GetPort(int idx) const
   return it->second;
 }
 
+void WavePortOperator::SetExcitation(int idx, bool excitation)
+{
+  auto it = ports.find(idx);
+  MFEM_VERIFY(it != ports.end(), "Unknown wave port index requested!");
+  it->second.excitation = excitation;
+}
+
 mfem::Array<int> WavePortOperator::GetAttrList() const
 {
   mfem::Array<int> attr_list;
@@ -1288,15 +1307,37 @@ void WavePortOperator::AddExtraSystemBdrCoefficients(double omega,
     {
       continue;
     }
-    const MaterialOperator &mat_op = data.mat_op;
-    MaterialPropertyCoefficient muinv_func(mat_op.GetBdrAttributeToMaterial(),
-                                           mat_op.GetInvPermeability());
-    muinv_func.RestrictCoefficient(mat_op.GetCeedBdrAttributes(data.GetAttrList()));
-    // fbr.AddCoefficient(muinv_func.GetAttributeToMaterial(),
-    //                    muinv_func.GetMaterialProperties(),
-    //                    -data.kn0.imag());
-    fbi.AddCoefficient(muinv_func.GetAttributeToMaterial(),
-                       muinv_func.GetMaterialProperties(), data.kn0.real());
+    // AddPortBdrCoefficients(data, -data.kn0.imag(), fbr);
+    AddPortBdrCoefficients(data, data.kn0.real(), fbi);
+  }
+}
+
+void WavePortOperator::AddExtraSystemBdrTerms(std::vector<MaterialPropertyCoefficient> &dfb,
+                                              std::vector<MaterialPropertyCoefficient> &fb)
+{
+  // Each active port contributes a boundary term with coefficient i Re{kₙ(ω)}.
+  for (const auto &[idx, data] : ports)
+  {
+    if (!data.active)
+    {
+      continue;
+    }
+    dfb.emplace_back(data.mat_op.MaxCeedBdrAttribute());
+    AddPortBdrCoefficients(data, 1.0, fb.emplace_back(data.mat_op.MaxCeedBdrAttribute()));
+  }
+}
+
+void WavePortOperator::AddExtraSystemCoefficients(double omega,
+                                                  std::vector<std::complex<double>> &coeff)
+{
+  Initialize(omega);
+  for (const auto &[idx, data] : ports)
+  {
+    if (!data.active)
+    {
+      continue;
+    }
+    coeff.emplace_back(0.0, data.kn0.real());
   }
 }
 
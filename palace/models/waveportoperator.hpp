@@ -156,6 +156,10 @@ public:
   auto rend() const { return ports.rend(); }
   auto Size() const { return ports.size(); }
 
+  // Enable or disable the excitation for the wave port with the given index, for exciting
+  // ports one at a time.
+  void SetExcitation(int idx, bool excitation);
+
   // Enable or suppress all outputs (log printing and fields to disk).
   void SetSuppressOutput(bool suppress) { suppress_output = suppress; }
 
@@ -166,6 +170,13 @@ public:
   void AddExtraSystemBdrCoefficients(double omega, MaterialPropertyCoefficient &fbr,
                                      MaterialPropertyCoefficient &fbi);
 
+  // Add the frequency-independent terms of the extra system matrix contributions, one per
+  // entry of dfb and fb, and the corresponding frequency-dependent scalar coefficients
+  // (which require the port modes at the given frequency).
+  void AddExtraSystemBdrTerms(std::vector<MaterialPropertyCoefficient> &dfb,
+                              std::vector<MaterialPropertyCoefficient> &fb);
+  void AddExtraSystemCoefficients(double omega, std::vector<std::complex<double>> &coeff);
+
   // Add contributions to the right-hand side source term vector for an incident field at
   // excited port boundaries.
   void AddExcitationBdrCoefficients(double omega, SumVectorCoefficient &fbr,
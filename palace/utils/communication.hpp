@@ -4,7 +4,11 @@
 #ifndef PALACE_UTILS_COMMUNICATION_HPP
 #define PALACE_UTILS_COMMUNICATION_HPP
 
+#include <algorithm>
 #include <complex>
+#include <type_traits>
+#include <utility>
+#include <vector>
 #include <fmt/color.h>
 #include <fmt/format.h>
 #include <fmt/printf.h>
@@ -245,6 +249,7 @@ public:
   template <typename T>
   static void GlobalOp(int len, T *buff, MPI_Op op, MPI_Comm comm)
   {
+    num_reductions++;
     MPI_Allreduce(MPI_IN_PLACE, buff, len, mpi::DataType<T>(), op, comm);
   }
 
@@ -269,6 +274,76 @@ public:
     GlobalOp(len, buff, MPI_SUM, comm);
   }
 
+  // Simultaneous global minimum and maximum (in-place, results are broadcast to all
+  // processes), using a single reduction.
+  template <typename T>
+  static void GlobalMinMax(int len, T *min, T *max, MPI_Comm comm)
+  {
+    static_assert(std::is_signed<T>::value,
+                  "GlobalMinMax requires a signed type for the combined reduction!");
+    std::vector<T> buffer(2 * len);
+    for (int i = 0; i < len; i++)
+    {
+      buffer[i] = min[i];
+      buffer[len + i] = -max[i];
+    }
+    GlobalMin(2 * len, buffer.data(), comm);
+    for (int i = 0; i < len; i++)
+    {
+      min[i] = buffer[i];
+      max[i] = -buffer[len + i];
+    }
+  }
+
+  // Wrapper for MPI_Iallreduce. The buffer must not be accessed until the returned request
+  // has completed with a call to Wait.
+  template <typename T>
+  static MPI_Request GlobalOpBegin(int len, T *buff, MPI_Op op, MPI_Comm comm)
+  {
+    MPI_Request req;
+    num_reductions++;
+    MPI_Iallreduce(MPI_IN_PLACE, buff, len, mpi::DataType<T>(), op, comm, &req);
+    return req;
+  }
+
+  // Nonblocking global minimum (in-place, result is broadcast to all processes).
+  template <typename T>
+  static MPI_Request GlobalMinBegin(int len, T *buff, MPI_Comm comm)
+  {
+    return GlobalOpBegin(len, buff, MPI_MIN, comm);
+  }
+
+  // Nonblocking global maximum (in-place, result is broadcast to all processes).
+  template <typename T>
+  static MPI_Request GlobalMaxBegin(int len, T *buff, MPI_Comm comm)
+  {
+    return GlobalOpBegin(len, buff, MPI_MAX, comm);
+  }
+
+  // Nonblocking global sum (in-place, result is broadcast to all processes).
+  template <typename T>
+  static MPI_Request GlobalSumBegin(int len, T *buff, MPI_Comm comm)
+  {
+    return GlobalOpBegin(len, buff, MPI_SUM, comm);
+  }
+
+  // Wait for completion of a nonblocking communication request.
+  static void Wait(MPI_Request &req) { MPI_Wait(&req, MPI_STATUS_IGNORE); }
+
+  // Wait for completion of several nonblocking communication requests.
+  static void WaitAll(int len, MPI_Request *reqs)
+  {
+    MPI_Waitall(len, reqs, MPI_STATUSES_IGNORE);
+  }
+
+  // Test for completion of a nonblocking communication request, without blocking.
+  static bool Test(MPI_Request &req)
+  {
+    int flag;
+    MPI_Test(&req, &flag, MPI_STATUS_IGNORE);
+    return flag;
+  }
+
   // Global minimum with index (in-place, result is broadcast to all processes).
   template <typename T, typename U>
   static void GlobalMinLoc(int len, T *val, U *loc, MPI_Comm comm)
@@ -324,6 +399,15 @@ public:
     MPI_Bcast(buff, len, mpi::DataType<T>(), root, comm);
   }
 
+  // Nonblocking global broadcast from root.
+  template <typename T>
+  static MPI_Request BroadcastBegin(int len, T *buff, int root, MPI_Comm comm)
+  {
+    MPI_Request req;
+    MPI_Ibcast(buff, len, mpi::DataType<T>(), root, comm, &req);
+    return req;
+  }
+
   // Print methods only print on the root process of MPI_COMM_WORLD or a given MPI_Comm.
   template <typename... T>
   static void Print(MPI_Comm comm, fmt::format_string<T...> fmt, T &&...args)
@@ -372,6 +456,10 @@ public:
   // Return the global communicator.
   static MPI_Comm World() { return MPI_COMM_WORLD; }
 
+  // Return the number of global reductions started on this process (blocking or
+  // nonblocking), for solver telemetry.
+  static std::size_t NumGlobalReductions() { return num_reductions; }
+
   // Default level of threading used in MPI_Init_thread unless provided to Init.
 #if defined(MFEM_USE_OPENMP)
   inline static int default_thread_required = MPI_THREAD_FUNNELED;
@@ -380,6 +468,9 @@ public:
 #endif
 
 private:
+  // Counter for global reductions.
+  inline static std::size_t num_reductions = 0;
+
   // Prevent direct construction of objects of this class.
   Mpi() = default;
   ~Mpi() { Finalize(); }
@@ -405,6 +496,67 @@ private:
   }
 };
 
+//
+// Helper for packing several small reductions of the same type and operation, for values
+// which may be stored in separate locations, into a single (optionally nonblocking) global
+// reduction. Values are copied into the batch when added and the results are written back
+// to the original locations upon completion.
+//
+template <typename T>
+class ReductionBatch
+{
+private:
+  // Reduction operation.
+  MPI_Op op;
+
+  // Packed values and the locations to write back the results.
+  std::vector<T> buff;
+  std::vector<std::pair<T *, int>> targets;
+
+  // Request for the active nonblocking reduction.
+  MPI_Request req;
+
+public:
+  ReductionBatch(MPI_Op op = MPI_SUM) : op(op), req(MPI_REQUEST_NULL) {}
+
+  // Append values to the batch, which must not be accessed until the reduction completes.
+  void Add(int len, T *vals)
+  {
+    MFEM_ASSERT(req == MPI_REQUEST_NULL, "Cannot add to an active reduction batch!");
+    buff.insert(buff.end(), vals, vals + len);
+    targets.emplace_back(vals, len);
+  }
+  void Add(T &val) { Add(1, &val); }
+
+  // Begin the nonblocking reduction of all values in the batch.
+  void Begin(MPI_Comm comm)
+  {
+    req = Mpi::GlobalOpBegin(static_cast<int>(buff.size()), buff.data(), op, comm);
+  }
+
+  // Wait for completion of the reduction and write back the results. The batch is then
+  // empty and can be reused.
+  void Wait()
+  {
+    Mpi::Wait(req);
+    auto it = buff.begin();
+    for (auto &[vals, len] : targets)
+    {
+      std::copy(it, it + len, vals);
+      it += len;
+    }
+    buff.clear();
+    targets.clear();
+  }
+
+  // Blocking reduction of all values in the batch.
+  void Reduce(MPI_Comm comm)
+  {
+    Begin(comm);
+    Wait();
+  }
+};
+
 }  // namespace palace
 
 #endif  // PALACE_UTILS_COMMUNICATION_HPP
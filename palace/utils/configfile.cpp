@@ -1425,6 +1425,16 @@ void DrivenSolverData::SetUp(json &solver)
   adaptive_tol = driven->value("AdaptiveTol", adaptive_tol);
   adaptive_max_size = driven->value("AdaptiveMaxSamples", adaptive_max_size);
   adaptive_memory = driven->value("AdaptiveConvergenceMemory", adaptive_memory);
+  adaptive_batch_size = driven->value("AdaptiveBatchSize", adaptive_batch_size);
+  adaptive_inexact_factor = driven->value("AdaptiveInexactFactor", adaptive_inexact_factor);
+  adaptive_save_rom = driven->value("AdaptiveSaveROM", adaptive_save_rom);
+  adaptive_load_rom = driven->value("AdaptiveLoadROM", adaptive_load_rom);
+  n_group = driven->value("FrequencyGroups", n_group);
+  pc_reuse_tol = driven->value("PCReuseFreqTol", pc_reuse_tol);
+  pc_reuse_it_factor = driven->value("PCReuseItsFactor", pc_reuse_it_factor);
+  guess_order = driven->value("InitialGuessOrder", guess_order);
+  separate_excitations = driven->value("SeparateExcitations", separate_excitations);
+  port_qoi_tol = driven->value("PortQuantityTol", port_qoi_tol);
 
   // Cleanup
   driven->erase("MinFreq");
@@ -1435,6 +1445,16 @@ void DrivenSolverData::SetUp(json &solver)
   driven->erase("AdaptiveTol");
   driven->erase("AdaptiveMaxSamples");
   driven->erase("AdaptiveConvergenceMemory");
+  driven->erase("AdaptiveBatchSize");
+  driven->erase("AdaptiveInexactFactor");
+  driven->erase("AdaptiveSaveROM");
+  driven->erase("AdaptiveLoadROM");
+  driven->erase("FrequencyGroups");
+  driven->erase("PCReuseFreqTol");
+  driven->erase("PCReuseItsFactor");
+  driven->erase("InitialGuessOrder");
+  driven->erase("SeparateExcitations");
+  driven->erase("PortQuantityTol");
   MFEM_VERIFY(driven->empty(),
               "Found an unsupported configuration file keyword under \"Driven\"!\n"
                   << driven->dump(2));
@@ -1450,6 +1470,16 @@ void DrivenSolverData::SetUp(json &solver)
     std::cout << "AdaptiveTol: " << adaptive_tol << '\n';
     std::cout << "AdaptiveMaxSamples: " << adaptive_max_size << '\n';
     std::cout << "AdaptiveConvergenceMemory: " << adaptive_memory << '\n';
+    std::cout << "AdaptiveBatchSize: " << adaptive_batch_size << '\n';
+    std::cout << "AdaptiveInexactFactor: " << adaptive_inexact_factor << '\n';
+    std::cout << "AdaptiveSaveROM: " << adaptive_save_rom << '\n';
+    std::cout << "AdaptiveLoadROM: " << adaptive_load_rom << '\n';
+    std::cout << "FrequencyGroups: " << n_group << '\n';
+    std::cout << "PCReuseFreqTol: " << pc_reuse_tol << '\n';
+    std::cout << "PCReuseItsFactor: " << pc_reuse_it_factor << '\n';
+    std::cout << "InitialGuessOrder: " << guess_order << '\n';
+    std::cout << "SeparateExcitations: " << separate_excitations << '\n';
+    std::cout << "PortQuantityTol: " << port_qoi_tol << '\n';
   }
 }
 
@@ -1620,7 +1650,8 @@ void TransientSolverData::SetUp(json &solver)
 
 // Helpers for converting string keys to enum for LinearSolverData::Type,
 // LinearSolverData::KspType, LinearSolverData::SideType,
-// LinearSolverData::MultigridCoarsenType, LinearSolverData::SymFactType,
+// LinearSolverData::MultigridCoarsenType, LinearSolverData::MultigridCycleType,
+// LinearSolverData::MultigridPatchType, LinearSolverData::SymFactType,
 // LinearSolverData::CompressionType, and LinearSolverData::OrthogType.
 PALACE_JSON_SERIALIZE_ENUM(LinearSolverData::Type,
                            {{LinearSolverData::Type::DEFAULT, "Default"},
@@ -1630,14 +1661,21 @@ PALACE_JSON_SERIALIZE_ENUM(LinearSolverData::Type,
                             {LinearSolverData::Type::SUPERLU, "SuperLU"},
                             {LinearSolverData::Type::STRUMPACK, "STRUMPACK"},
                             {LinearSolverData::Type::STRUMPACK_MP, "STRUMPACK-MP"},
+                            {LinearSolverData::Type::SCHWARZ, "Schwarz"},
                             {LinearSolverData::Type::JACOBI, "Jacobi"}})
 PALACE_JSON_SERIALIZE_ENUM(LinearSolverData::KspType,
                            {{LinearSolverData::KspType::DEFAULT, "Default"},
                             {LinearSolverData::KspType::CG, "CG"},
+                            {LinearSolverData::KspType::DEFLATEDCG, "DeflatedCG"},
                             {LinearSolverData::KspType::MINRES, "MINRES"},
                             {LinearSolverData::KspType::GMRES, "GMRES"},
                             {LinearSolverData::KspType::FGMRES, "FGMRES"},
-                            {LinearSolverData::KspType::BICGSTAB, "BiCGSTAB"}})
+                            {LinearSolverData::KspType::PGMRES, "PGMRES"},
+                            {LinearSolverData::KspType::SSTEPGMRES, "SStepGMRES"},
+                            {LinearSolverData::KspType::GCRODR, "GCRODR"},
+                            {LinearSolverData::KspType::BICGSTAB, "BiCGSTAB"},
+                            {LinearSolverData::KspType::COCG, "COCG"},
+                            {LinearSolverData::KspType::COCR, "COCR"}})
 PALACE_JSON_SERIALIZE_ENUM(LinearSolverData::SideType,
                            {{LinearSolverData::SideType::DEFAULT, "Default"},
                             {LinearSolverData::SideType::RIGHT, "Right"},
@@ -1646,6 +1684,15 @@ PALACE_JSON_SERIALIZE_ENUM(LinearSolverData::MultigridCoarsenType,
                            {{LinearSolverData::MultigridCoarsenType::LINEAR, "Linear"},
                             {LinearSolverData::MultigridCoarsenType::LOGARITHMIC,
                              "Logarithmic"}})
+PALACE_JSON_SERIALIZE_ENUM(LinearSolverData::MultigridCycleType,
+                           {{LinearSolverData::MultigridCycleType::V, "V"},
+                            {LinearSolverData::MultigridCycleType::W, "W"},
+                            {LinearSolverData::MultigridCycleType::F, "F"},
+                            {LinearSolverData::MultigridCycleType::ADDITIVE, "Additive"}})
+PALACE_JSON_SERIALIZE_ENUM(LinearSolverData::MultigridPatchType,
+                           {{LinearSolverData::MultigridPatchType::NONE, "None"},
+                            {LinearSolverData::MultigridPatchType::ELEMENT, "Element"},
+                            {LinearSolverData::MultigridPatchType::VERTEX, "Vertex"}})
 PALACE_JSON_SERIALIZE_ENUM(LinearSolverData::SymFactType,
                            {{LinearSolverData::SymFactType::DEFAULT, "Default"},
                             {LinearSolverData::SymFactType::METIS, "METIS"},
@@ -1681,15 +1728,23 @@ void LinearSolverData::SetUp(json &solver)
   tol = linear->value("Tol", tol);
   max_it = linear->value("MaxIts", max_it);
   max_size = linear->value("MaxSize", max_size);
+  recycle_size = linear->value("RecycleSize", recycle_size);
+  step_size = linear->value("StepSize", step_size);
   initial_guess = linear->value("InitialGuess", initial_guess);
+  telemetry = linear->value("Telemetry", telemetry);
 
   // Options related to multigrid.
   mg_max_levels = linear->value("MGMaxLevels", mg_max_levels);
   mg_coarsen_type = linear->value("MGCoarsenType", mg_coarsen_type);
   mg_use_mesh = linear->value("MGUseMesh", mg_use_mesh);
+  mg_coarse_dofs_per_proc =
+      linear->value("MGCoarseDofsPerProcess", mg_coarse_dofs_per_proc);
   mg_cycle_it = linear->value("MGCycleIts", mg_cycle_it);
+  mg_cycle_type = linear->value("MGCycleType", mg_cycle_type);
   mg_smooth_aux = linear->value("MGAuxiliarySmoother", mg_smooth_aux);
+  mg_smooth_patch = linear->value("MGPatchSmoother", mg_smooth_patch);
   mg_smooth_it = linear->value("MGSmoothIts", mg_smooth_it);
+  mg_smooth_it_levels = linear->value("MGSmoothItsPerLevel", mg_smooth_it_levels);
   mg_smooth_order = linear->value("MGSmoothOrder", mg_smooth_order);
   mg_smooth_sf_max = linear->value("MGSmoothEigScaleMax", mg_smooth_sf_max);
   mg_smooth_sf_min = linear->value("MGSmoothEigScaleMin", mg_smooth_sf_min);
@@ -1707,6 +1762,7 @@ void LinearSolverData::SetUp(json &solver)
       linear->value("STRUMPACKLossyPrecision", strumpack_lossy_precision);
   strumpack_butterfly_l = linear->value("STRUMPACKButterflyLevels", strumpack_butterfly_l);
   superlu_3d = linear->value("SuperLU3DCommunicator", superlu_3d);
+  schwarz_overlap = linear->value("SchwarzOverlap", schwarz_overlap);
   ams_vector_interp = linear->value("AMSVectorInterpolation", ams_vector_interp);
   ams_singular_op = linear->value("AMSSingularOperator", ams_singular_op);
   amg_agg_coarsen = linear->value("AMGAggressiveCoarsening", amg_agg_coarsen);
@@ -1725,14 +1781,21 @@ void LinearSolverData::SetUp(json &solver)
   linear->erase("Tol");
   linear->erase("MaxIts");
   linear->erase("MaxSize");
+  linear->erase("RecycleSize");
+  linear->erase("StepSize");
   linear->erase("InitialGuess");
+  linear->erase("Telemetry");
 
   linear->erase("MGMaxLevels");
   linear->erase("MGCoarsenType");
   linear->erase("MGUseMesh");
+  linear->erase("MGCoarseDofsPerProcess");
   linear->erase("MGCycleIts");
+  linear->erase("MGCycleType");
   linear->erase("MGAuxiliarySmoother");
+  linear->erase("MGPatchSmoother");
   linear->erase("MGSmoothIts");
+  linear->erase("MGSmoothItsPerLevel");
   linear->erase("MGSmoothOrder");
   linear->erase("MGSmoothEigScaleMax");
   linear->erase("MGSmoothEigScaleMin");
@@ -1747,6 +1810,7 @@ void LinearSolverData::SetUp(json &solver)
   linear->erase("STRUMPACKLossyPrecision");
   linear->erase("STRUMPACKButterflyLevels");
   linear->erase("SuperLU3DCommunicator");
+  linear->erase("SchwarzOverlap");
   linear->erase("AMSVectorInterpolation");
   linear->erase("AMSSingularOperator");
   linear->erase("AMGAggressiveCoarsening");
@@ -1769,14 +1833,21 @@ void LinearSolverData::SetUp(json &solver)
     std::cout << "Tol: " << tol << '\n';
     std::cout << "MaxIts: " << max_it << '\n';
     std::cout << "MaxSize: " << max_size << '\n';
+    std::cout << "RecycleSize: " << recycle_size << '\n';
+    std::cout << "StepSize: " << step_size << '\n';
     std::cout << "InitialGuess: " << initial_guess << '\n';
+    std::cout << "Telemetry: " << telemetry << '\n';
 
     std::cout << "MGMaxLevels: " << mg_max_levels << '\n';
     std::cout << "MGCoarsenType: " << mg_coarsen_type << '\n';
     std::cout << "MGUseMesh: " << mg_use_mesh << '\n';
+    std::cout << "MGCoarseDofsPerProcess: " << mg_coarse_dofs_per_proc << '\n';
     std::cout << "MGCycleIts: " << mg_cycle_it << '\n';
+    std::cout << "MGCycleType: " << mg_cycle_type << '\n';
     std::cout << "MGAuxiliarySmoother: " << mg_smooth_aux << '\n';
+    std::cout << "MGPatchSmoother: " << mg_smooth_patch << '\n';
     std::cout << "MGSmoothIts: " << mg_smooth_it << '\n';
+    std::cout << "MGSmoothItsPerLevel: " << mg_smooth_it_levels << '\n';
     std::cout << "MGSmoothOrder: " << mg_smooth_order << '\n';
     std::cout << "MGSmoothEigScaleMax: " << mg_smooth_sf_max << '\n';
     std::cout << "MGSmoothEigScaleMin: " << mg_smooth_sf_min << '\n';
@@ -1791,6 +1862,7 @@ void LinearSolverData::SetUp(json &solver)
     std::cout << "STRUMPACKLossyPrecision: " << strumpack_lossy_precision << '\n';
     std::cout << "STRUMPACKButterflyLevels: " << strumpack_butterfly_l << '\n';
     std::cout << "SuperLU3DCommunicator: " << superlu_3d << '\n';
+    std::cout << "SchwarzOverlap: " << schwarz_overlap << '\n';
     std::cout << "AMSVectorInterpolation: " << ams_vector_interp << '\n';
     std::cout << "AMSSingularOperator: " << ams_singular_op << '\n';
     std::cout << "AMGAggressiveCoarsening: " << amg_agg_coarsen << '\n';
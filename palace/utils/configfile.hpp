@@ -641,6 +641,46 @@ public:
   // Memory required for adaptive sampling convergence.
   int adaptive_memory = 2;
 
+  // Number of frequency samples added per greedy iteration of adaptive frequency sweep.
+  int adaptive_batch_size = 1;
+
+  // Factor relating the relative tolerance for inexact HDM solves during the adaptive
+  // frequency sweep greedy iterations to the current error estimate (zero for exact
+  // solves with the configured linear solver tolerance).
+  double adaptive_inexact_factor = 0.0;
+
+  // Directory to which the reduced-order model is written after the adaptive frequency
+  // sweep offline phase.
+  std::string adaptive_save_rom = "";
+
+  // Directory from which a previously saved reduced-order model is read, skipping the
+  // adaptive frequency sweep offline phase.
+  std::string adaptive_load_rom = "";
+
+  // Number of process groups for frequency-parallel uniform frequency sweep.
+  int n_group = 1;
+
+  // Relative frequency distance over which to reuse the preconditioner for uniform
+  // frequency sweep (zero rebuilds it at every frequency).
+  double pc_reuse_tol = 0.0;
+
+  // Rebuild a reused preconditioner when the number of linear solver iterations exceeds
+  // this factor times the iterations of the first solve with it.
+  double pc_reuse_it_factor = 1.5;
+
+  // Order of polynomial extrapolation from previous solutions for the linear solver initial
+  // guess in uniform frequency sweep (zero uses the previous solution).
+  int guess_order = 0;
+
+  // Solve separately for each port marked for excitation in uniform frequency sweep,
+  // sharing the system operators and preconditioner, to compute the full S-matrix.
+  bool separate_excitations = false;
+
+  // Relative tolerance on the change in the lumped port S-parameters and voltages over the
+  // linear solver iterations in uniform frequency sweep, used to stop the solve once these
+  // quantities have converged (zero uses only the residual-based stopping criterion).
+  double port_qoi_tol = 0.0;
+
   void SetUp(json &solver);
 };
 
@@ -759,6 +799,7 @@ public:
     SUPERLU,
     STRUMPACK,
     STRUMPACK_MP,
+    SCHWARZ,
     JACOBI
   };
   Type type = Type::DEFAULT;
@@ -768,10 +809,16 @@ public:
   {
     DEFAULT,
     CG,
+    DEFLATEDCG,
     MINRES,
     GMRES,
     FGMRES,
-    BICGSTAB
+    PGMRES,
+    SSTEPGMRES,
+    GCRODR,
+    BICGSTAB,
+    COCG,
+    COCR
   };
   KspType ksp_type = KspType::DEFAULT;
 
@@ -784,9 +831,19 @@ public:
   // Maximum Krylov space dimension for GMRES/FGMRES iterative solvers.
   int max_size = -1;
 
+  // Maximum dimension of the recycled subspace for the GCRO-DR and deflated CG iterative
+  // solvers.
+  int recycle_size = 10;
+
+  // Number of Krylov vectors generated per block for the s-step GMRES iterative solver.
+  int step_size = 5;
+
   // Reuse previous solution as initial guess for Krylov solvers.
   int initial_guess = -1;
 
+  // Record per-iteration telemetry for all linear solves and write it to disk.
+  bool telemetry = false;
+
   // Maximum number of levels for geometric multigrid (set to 1 to disable multigrid).
   int mg_max_levels = 100;
 
@@ -802,17 +859,46 @@ public:
   // from uniform refinement.
   bool mg_use_mesh = true;
 
+  // Target number of unknowns per process for the geometric multigrid coarse-level solve,
+  // which is redistributed onto fewer processes when there are too few coarse unknowns
+  // (0 to disable).
+  int mg_coarse_dofs_per_proc = 0;
+
   // Number of iterations for preconditioners which support it. For multigrid, this is the
-  // number of V-cycles per Krylov solver iteration.
+  // number of cycles per Krylov solver iteration.
   int mg_cycle_it = 1;
 
+  // Type of cycle for geometric multigrid.
+  enum class MultigridCycleType
+  {
+    V,
+    W,
+    F,
+    ADDITIVE
+  };
+  MultigridCycleType mg_cycle_type = MultigridCycleType::V;
+
   // Use auxiliary space smoothers on geometric multigrid levels.
   int mg_smooth_aux = -1;
 
+  // Use overlapping patch smoothers on geometric multigrid levels instead of Chebyshev
+  // smoothing, with patches made up of the unknowns on each element or around each vertex.
+  enum class MultigridPatchType
+  {
+    NONE,
+    ELEMENT,
+    VERTEX
+  };
+  MultigridPatchType mg_smooth_patch = MultigridPatchType::NONE;
+
   // Number of pre-/post-smoothing iterations at each geometric or algebraic multigrid
   // level.
   int mg_smooth_it = 1;
 
+  // Number of pre-/post-smoothing iterations for each geometric multigrid level, starting
+  // from the finest (levels not specified use mg_smooth_it).
+  std::vector<int> mg_smooth_it_levels = {};
+
   // Order of polynomial smoothing for geometric multigrid.
   int mg_smooth_order = -1;
 
@@ -877,6 +963,10 @@ public:
   // Option to enable 3D process grid for SuperLU_DIST solver.
   bool superlu_3d = false;
 
+  // Number of layers of algebraic overlap for the restricted additive Schwarz
+  // preconditioner subdomains.
+  int schwarz_overlap = 1;
+
   // Option to use vector or scalar Pi-space corrections for the AMS preconditioner.
   bool ams_vector_interp = false;
 
@@ -63,8 +63,7 @@ std::array<double, 2> ComputeDorflerThreshold(MPI_Comm comm, const Vector &e,
   // processors.
   double min_threshold = error_threshold;
   double max_threshold = error_threshold;
-  Mpi::GlobalMin(1, &min_threshold, comm);
-  Mpi::GlobalMax(1, &max_threshold, comm);
+  Mpi::GlobalMinMax(1, &min_threshold, &max_threshold, comm);
   struct
   {
     std::size_t total;
@@ -81,18 +80,15 @@ std::array<double, 2> ComputeDorflerThreshold(MPI_Comm comm, const Vector &e,
   error.total = local_total;
   std::tie(elements.max_marked, error.max_marked) = Marked(min_threshold);
   std::tie(elements.min_marked, error.min_marked) = Marked(max_threshold);
-  Mpi::GlobalSum(3, &elements.total, comm);
-  Mpi::GlobalSum(3, &error.total, comm);
-  const double max_indicator = [&]()
-  {
-    double max_indicator = estimates.size() > 0 ? estimates.back() : 0.0;
-    Mpi::GlobalMax(1, &max_indicator, comm);
-    return max_indicator;
-  }();
+  double max_indicator = estimates.size() > 0 ? estimates.back() : 0.0;
+  MPI_Request reqs[3] = {Mpi::GlobalSumBegin(3, &elements.total, comm),
+                         Mpi::GlobalSumBegin(3, &error.total, comm),
+                         Mpi::GlobalMaxBegin(1, &max_indicator, comm)};
   MFEM_ASSERT(min_threshold <= max_threshold,
               "Error in Dorfler marking: min: " << min_threshold << " max " << max_threshold
                                                 << "!");
   auto [elem_marked, error_marked] = Marked(error_threshold);
+  Mpi::WaitAll(3, reqs);
 
   // Keep track of the number of elements marked by the threshold bounds. If the top and
   // bottom values are equal (or separated by only 1), there's no point further bisecting.
@@ -103,9 +99,13 @@ std::array<double, 2> ComputeDorflerThreshold(MPI_Comm comm, const Vector &e,
     error_threshold = (min_threshold + max_threshold) / 2;
     std::tie(elem_marked, error_marked) = Marked(error_threshold);
 
-    // All processors need the values used for the stopping criteria.
-    Mpi::GlobalSum(1, &elem_marked, comm);
-    Mpi::GlobalSum(1, &error_marked, comm);
+    // All processors need the values used for the stopping criteria. The marked element
+    // count is reduced alongside the marked error as a double (exact for any realistic
+    // number of elements), with a single reduction.
+    double marked[2] = {static_cast<double>(elem_marked), error_marked};
+    Mpi::GlobalSum(2, marked, comm);
+    elem_marked = static_cast<std::size_t>(marked[0]);
+    error_marked = marked[1];
     MFEM_ASSERT(elem_marked > 0, "Some elements must have been marked!");
     MFEM_ASSERT(error_marked > 0, "Some error must have been marked!");
     const auto candidate_fraction = error_marked / error.total;
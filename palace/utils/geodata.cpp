@@ -746,8 +746,7 @@ void GetAxisAlignedBoundingBox(const mfem::ParMesh &mesh, const mfem::Array<int>
       }
     }
   }
-  Mpi::GlobalMin(dim, min.HostReadWrite(), mesh.GetComm());
-  Mpi::GlobalMax(dim, max.HostReadWrite(), mesh.GetComm());
+  Mpi::GlobalMinMax(dim, min.HostReadWrite(), max.HostReadWrite(), mesh.GetComm());
 }
 
 double BoundingBox::Area() const
@@ -1630,8 +1629,7 @@ double RebalanceMesh(std::unique_ptr<mfem::ParMesh> &mesh, const IoData &iodata)
   }
   int min_elem, max_elem;
   min_elem = max_elem = mesh->GetNE();
-  Mpi::GlobalMin(1, &min_elem, comm);
-  Mpi::GlobalMax(1, &max_elem, comm);
+  Mpi::GlobalMinMax(1, &min_elem, &max_elem, comm);
   const double ratio = double(max_elem) / min_elem;
   const double tol = iodata.model.refinement.maximum_imbalance;
   if constexpr (false)
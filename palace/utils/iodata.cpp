@@ -321,6 +321,31 @@ void IoData::CheckConfiguration()
     }
   }
 
+  // Frequency-parallel sweeps are only available for the uniform frequency sweep, without
+  // adaptive mesh refinement.
+  if (problem.type == config::ProblemData::Type::DRIVEN && solver.driven.n_group > 1 &&
+      (solver.driven.adaptive_tol > 0.0 || !solver.driven.adaptive_load_rom.empty() ||
+       model.refinement.max_it > 0))
+  {
+    Mpi::Warning("Frequency-parallel driven sweep (\"FrequencyGroups\" > 1) is not "
+                 "supported for adaptive frequency sweep or AMR, reverting to a single "
+                 "group!\n");
+    solver.driven.n_group = 1;
+  }
+  MFEM_VERIFY(problem.type != config::ProblemData::Type::DRIVEN ||
+                  !solver.driven.separate_excitations || solver.driven.adaptive_tol <= 0.0,
+              "Separate port excitations (\"SeparateExcitations\") are not supported for "
+              "adaptive frequency sweep!");
+  MFEM_VERIFY(problem.type != config::ProblemData::Type::DRIVEN ||
+                  solver.driven.adaptive_load_rom.empty() ||
+                  (!solver.driven.separate_excitations && model.refinement.max_it == 0),
+              "Loading a reduced-order model (\"AdaptiveLoadROM\") is not supported with "
+              "separate port excitations or adaptive mesh refinement!");
+  MFEM_VERIFY(solver.driven.adaptive_inexact_factor >= 0.0 &&
+                  solver.driven.adaptive_inexact_factor < 1.0,
+              "Inexact solve factor for adaptive frequency sweep "
+              "(\"AdaptiveInexactFactor\") must be in [0, 1)!");
+
   // Resolve default values in configuration file.
   if (solver.linear.type == config::LinearSolverData::Type::DEFAULT)
   {
@@ -397,13 +422,21 @@ void IoData::CheckConfiguration()
       solver.linear.pc_mat_shifted = 0;
     }
   }
+  if (solver.linear.mg_smooth_aux > 0 &&
+      solver.linear.mg_smooth_patch != config::LinearSolverData::MultigridPatchType::NONE)
+  {
+    Mpi::Warning("Patch smoothing (\"MGPatchSmoother\") replaces auxiliary space smoothing "
+                 "(\"MGAuxiliarySmoother\"), disabling auxiliary space smoothing!\n");
+    solver.linear.mg_smooth_aux = 0;
+  }
   if (solver.linear.mg_smooth_aux < 0)
   {
     if (problem.type == config::ProblemData::Type::ELECTROSTATIC ||
-        problem.type == config::ProblemData::Type::MAGNETOSTATIC)
+        problem.type == config::ProblemData::Type::MAGNETOSTATIC ||
+        solver.linear.mg_smooth_patch != config::LinearSolverData::MultigridPatchType::NONE)
     {
       // Disable auxiliary space smoothing using distributive relaxation by default for
-      // problems which don't need it.
+      // problems which don't need it, or when it is replaced by patch smoothing.
       solver.linear.mg_smooth_aux = 0;
     }
     else
@@ -0,0 +1,45 @@
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#include <mfem.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include "utils/communication.hpp"
+
+namespace palace
+{
+
+TEST_CASE("Reduction Batch", "[Mpi]")
+{
+  // A batch of reductions of values stored in separate locations should give the same
+  // result as reducing each value on its own.
+  MPI_Comm comm = Mpi::World();
+  const int rank = Mpi::Rank(comm), size = Mpi::Size(comm);
+  double a = rank + 1.0, b[3] = {1.0, 2.0 * rank, -3.0};
+  int c = 2 * rank;
+  ReductionBatch<double> batch;
+  batch.Add(a);
+  batch.Add(3, b);
+  SECTION("Blocking")
+  {
+    batch.Reduce(comm);
+  }
+  SECTION("Nonblocking")
+  {
+    batch.Begin(comm);
+    Mpi::GlobalSum(1, &c, comm);
+    batch.Wait();
+    REQUIRE(c == size * (size - 1));
+  }
+  REQUIRE(a == 0.5 * size * (size + 1));
+  REQUIRE(b[0] == size);
+  REQUIRE(b[1] == size * (size - 1));
+  REQUIRE(b[2] == -3.0 * size);
+
+  // The batch is empty and can be reused after completion.
+  a = 1.0;
+  batch.Add(a);
+  batch.Reduce(comm);
+  REQUIRE(a == size);
+}
+
+}  // namespace palace
@@ -0,0 +1,94 @@
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#include <fstream>
+#include <string>
+#include <vector>
+#include <catch2/catch_test_macros.hpp>
+#include "drivers/drivensolver.hpp"
+#include "utils/communication.hpp"
+#include "utils/filesystem.hpp"
+
+namespace palace
+{
+
+namespace
+{
+
+namespace fs = std::filesystem;
+
+void WriteLines(const std::string &path, const std::vector<std::string> &lines)
+{
+  fs::create_directories(fs::path(path).parent_path());
+  std::ofstream fo(path);
+  for (const auto &line : lines)
+  {
+    fo << line << '\n';
+  }
+}
+
+std::vector<std::string> ReadLines(const std::string &path)
+{
+  std::ifstream fi(path);
+  std::vector<std::string> lines;
+  std::string line;
+  while (std::getline(fi, line))
+  {
+    lines.push_back(line);
+  }
+  return lines;
+}
+
+}  // namespace
+
+TEST_CASE("Frequency Group Merge", "[DrivenSolver]")
+{
+  // Five frequency samples distributed over two groups, with the rows for the separate
+  // excitation of port 1 in a subdirectory. Field output (without CSV files) remains in the
+  // group subdirectories.
+  if (!Mpi::Root(Mpi::World()))
+  {
+    return;
+  }
+  const std::string output =
+      (fs::temp_directory_path() / "palace-test-group-merge").string() + "/";
+  fs::remove_all(output);
+  for (const auto &file : {"port-S.csv", "excitation1/port-V.csv"})
+  {
+    WriteLines(output + "group0/" + file, {"f (GHz),Q", "1,a", "3,c", "5,e"});
+    WriteLines(output + "group1/" + file, {"f (GHz),Q", "2,b", "4,d"});
+  }
+  for (int g = 0; g < 2; g++)
+  {
+    WriteLines(output + "group" + std::to_string(g) + "/paraview/driven.pvd", {""});
+  }
+  SECTION("New Sweep")
+  {
+    DrivenSolver::MergeGroupPostprocessing(output, 2, false);
+    const std::vector<std::string> merged = {"f (GHz),Q", "1,a", "2,b",
+                                             "3,c",       "4,d", "5,e"};
+    CHECK(ReadLines(output + "port-S.csv") == merged);
+    CHECK(ReadLines(output + "excitation1/port-V.csv") == merged);
+  }
+  SECTION("Restarted Sweep")
+  {
+    WriteLines(output + "port-S.csv", {"f (GHz),Q", "0,z"});
+    WriteLines(output + "excitation1/port-V.csv", {"f (GHz),Q", "0,z"});
+    DrivenSolver::MergeGroupPostprocessing(output, 2, true);
+    const std::vector<std::string> merged = {"f (GHz),Q", "0,z", "1,a", "2,b",
+                                             "3,c",       "4,d", "5,e"};
+    CHECK(ReadLines(output + "port-S.csv") == merged);
+    CHECK(ReadLines(output + "excitation1/port-V.csv") == merged);
+  }
+  for (int g = 0; g < 2; g++)
+  {
+    const std::string group = output + "group" + std::to_string(g) + "/";
+    CHECK(!fs::exists(group + "port-S.csv"));
+    CHECK(!fs::exists(group + "excitation1/port-V.csv"));
+    CHECK(fs::exists(group + "paraview/driven.pvd"));
+  }
+  CHECK(!fs::exists(output + "paraview"));
+  fs::remove_all(output);
+}
+
+}  // namespace palace
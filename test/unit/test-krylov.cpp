@@ -0,0 +1,193 @@
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#include <memory>
+#include <type_traits>
+#include <mfem.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators_all.hpp>
+#include "linalg/iterative.hpp"
+#include "linalg/jacobi.hpp"
+#include "linalg/operator.hpp"
+#include "linalg/vector.hpp"
+#include "utils/communication.hpp"
+
+namespace palace
+{
+
+namespace
+{
+
+constexpr int test_size = 257;
+constexpr double test_tol = 1.0e-10;
+
+auto Tridiagonal(int n, double a, double b)
+{
+  // Tridiagonal matrix with a on the diagonal and b on the off-diagonals (the global
+  // operator is block diagonal with one block per process).
+  auto A = std::make_unique<mfem::SparseMatrix>(n, n);
+  for (int i = 0; i < n; i++)
+  {
+    A->Set(i, i, a);
+    if (i > 0)
+    {
+      A->Set(i, i - 1, b);
+    }
+    if (i + 1 < n)
+    {
+      A->Set(i, i + 1, b);
+    }
+  }
+  A->Finalize();
+  return A;
+}
+
+template <typename OperType>
+struct TestProblem;
+
+template <>
+struct TestProblem<Operator>
+{
+  // Real symmetric positive definite problem (shifted 1D Laplacian).
+  std::unique_ptr<mfem::SparseMatrix> A;
+  TestProblem(bool) : A(Tridiagonal(test_size, 2.1, -1.0)) {}
+  const Operator &Get() const { return *A; }
+};
+
+template <>
+struct TestProblem<ComplexOperator>
+{
+  // Complex symmetric problem A = K + i σ M, or the Hermitian positive definite problem
+  // with the imaginary part omitted.
+  std::unique_ptr<ComplexWrapperOperator> A;
+  TestProblem(bool herm)
+    : A(std::make_unique<ComplexWrapperOperator>(
+          Tridiagonal(test_size, 2.1, -1.0),
+          herm ? nullptr : Tridiagonal(test_size, 0.5, 0.1)))
+  {
+  }
+  const ComplexOperator &Get() const { return *A; }
+};
+
+template <typename OperType>
+void TestSolver(IterativeSolver<OperType> &ksp, bool herm, bool precond = false,
+                int n_solve = 1)
+{
+  // Solve with random right-hand sides and check the true residual.
+  using VecType = typename Solver<OperType>::VecType;
+  MPI_Comm comm = Mpi::World();
+  TestProblem<OperType> problem(herm);
+  const auto &A = problem.Get();
+  JacobiSmoother<OperType> pc(comm);
+  ksp.SetOperator(A);
+  if (precond)
+  {
+    pc.SetOperator(A);
+    ksp.SetPreconditioner(pc);
+  }
+  ksp.SetRelTol(test_tol);
+  ksp.SetAbsTol(0.0);
+  ksp.SetMaxIter(10 * test_size);
+  ksp.SetInitialGuess(false);
+  VecType b(test_size), x(test_size), r(test_size);
+  b.UseDevice(true);
+  x.UseDevice(true);
+  r.UseDevice(true);
+  for (int k = 0; k < n_solve; k++)
+  {
+    linalg::SetRandom(comm, b, 1 + k);
+    ksp.Mult(b, x);
+    REQUIRE(ksp.GetConverged());
+    A.Mult(x, r);
+    linalg::AXPBY(1.0, b, -1.0, r);
+    REQUIRE(linalg::Norml2(comm, r) <= 100.0 * test_tol * linalg::Norml2(comm, b));
+  }
+}
+
+template <typename OperType>
+void TestKrylovSolvers()
+{
+  MPI_Comm comm = Mpi::World();
+  constexpr bool complex = std::is_same<OperType, ComplexOperator>::value;
+  SECTION("CG")
+  {
+    CgSolver<OperType> ksp(comm, 0);
+    TestSolver(ksp, true);
+  }
+  SECTION("Deflated CG")
+  {
+    DeflatedCgSolver<OperType> ksp(comm, 0);
+    ksp.SetRecycleDim(8);
+    TestSolver(ksp, true, true, 3);
+  }
+  SECTION("MINRES")
+  {
+    MinResSolver<OperType> ksp(comm, 0);
+    TestSolver(ksp, !complex);
+  }
+  SECTION("BiCGSTAB")
+  {
+    BiCGStabSolver<OperType> ksp(comm, 0);
+    TestSolver(ksp, false, true);
+  }
+  SECTION("COCG")
+  {
+    CocgSolver<OperType> ksp(comm, 0);
+    TestSolver(ksp, !complex, true);
+  }
+  SECTION("COCR")
+  {
+    CocrSolver<OperType> ksp(comm, 0);
+    TestSolver(ksp, !complex);
+  }
+  SECTION("GMRES")
+  {
+    auto orthog = GENERATE(GmresSolverBase::OrthogType::MGS,
+                           GmresSolverBase::OrthogType::CGS,
+                           GmresSolverBase::OrthogType::CGS2);
+    GmresSolver<OperType> ksp(comm, 0);
+    ksp.SetRestartDim(40);
+    ksp.SetOrthogonalization(orthog);
+    TestSolver(ksp, false, true);
+  }
+  SECTION("FGMRES")
+  {
+    FgmresSolver<OperType> ksp(comm, 0);
+    ksp.SetRestartDim(40);
+    TestSolver(ksp, false, true);
+  }
+  SECTION("Pipelined GMRES")
+  {
+    PgmresSolver<OperType> ksp(comm, 0);
+    ksp.SetRestartDim(40);
+    TestSolver(ksp, false, true);
+  }
+  SECTION("s-step GMRES")
+  {
+    SStepGmresSolver<OperType> ksp(comm, 0);
+    ksp.SetRestartDim(40);
+    ksp.SetStepDim(5);
+    TestSolver(ksp, false, true);
+  }
+  SECTION("GCRO-DR")
+  {
+    GcroDrSolver<OperType> ksp(comm, 0);
+    ksp.SetRestartDim(30);
+    ksp.SetRecycleDim(10);
+    TestSolver(ksp, false, true, 3);
+  }
+}
+
+}  // namespace
+
+TEST_CASE("Real Krylov Solvers", "[Krylov]")
+{
+  TestKrylovSolvers<Operator>();
+}
+
+TEST_CASE("Complex Krylov Solvers", "[Krylov]")
+{
+  TestKrylovSolvers<ComplexOperator>();
+}
+
+}  // namespace palace
@@ -0,0 +1,53 @@
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#include <vector>
+#include <catch2/catch_test_macros.hpp>
+#include "models/romoperator.hpp"
+
+namespace palace
+{
+
+TEST_CASE("Inexact HDM Tolerance", "[RomOperator]")
+{
+  constexpr double factor = 0.1, ksp_tol = 1.0e-6, offline_tol = 1.0e-3;
+
+  // Without a previous error estimate, or with inexact solves disabled, the HDM solve uses
+  // the linear solver tolerance.
+  REQUIRE(RomOperator::GetInexactTolerance(factor, 0.0, ksp_tol, offline_tol) == ksp_tol);
+  REQUIRE(RomOperator::GetInexactTolerance(0.0, 0.5, ksp_tol, offline_tol) == ksp_tol);
+
+  // For a typical sequence of greedy error estimates, the tolerance is loosened well beyond
+  // the linear solver tolerance in early iterations and tightens as the PROM converges,
+  // never exceeding the offline tolerance.
+  const std::vector<double> errors = {1.0, 2.0e-1, 3.0e-2, 4.0e-3, 5.0e-4, 6.0e-5};
+  std::vector<double> tols;
+  for (auto error : errors)
+  {
+    tols.push_back(RomOperator::GetInexactTolerance(factor, error, ksp_tol, offline_tol));
+  }
+  REQUIRE(tols.front() == offline_tol);
+  REQUIRE(tols.front() >= 100.0 * ksp_tol);
+  for (std::size_t k = 0; k < tols.size(); k++)
+  {
+    REQUIRE(tols[k] > ksp_tol);
+    REQUIRE(tols[k] <= offline_tol);
+    REQUIRE(tols[k] <= factor * errors[k]);
+    if (k > 0)
+    {
+      REQUIRE(tols[k] <= tols[k - 1]);
+    }
+  }
+  REQUIRE(tols.back() < offline_tol);
+
+  // The linear solver tolerance is a floor, also when it is larger than a tenth of the
+  // offline tolerance.
+  REQUIRE(RomOperator::GetInexactTolerance(factor, 1.0e-6, ksp_tol, offline_tol) ==
+          ksp_tol);
+  REQUIRE(RomOperator::GetInexactTolerance(factor, 1.0, 5.0e-4, offline_tol) ==
+          offline_tol);
+  REQUIRE(RomOperator::GetInexactTolerance(factor, 4.0e-3, 5.0e-4, offline_tol) ==
+          5.0e-4);
+}
+
+}  // namespace palace
@@ -0,0 +1,91 @@
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <vector>
+#include <mfem.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators_all.hpp>
+#include "linalg/vector.hpp"
+#include "utils/communication.hpp"
+
+namespace palace
+{
+
+namespace
+{
+
+double MaxNorm(const Vector &x)
+{
+  return x.Normlinf();
+}
+
+double MaxNorm(const ComplexVector &x)
+{
+  return std::max(x.Real().Normlinf(), x.Imag().Normlinf());
+}
+
+template <typename VecType, typename ScalarType>
+void TestMultiVectorKernels(int size, int n)
+{
+  // Compare the fused multi-vector kernels against the equivalent sequence of single vector
+  // operations. The vector sizes are chosen to not be divisible by the row block size of
+  // the kernels.
+  MPI_Comm comm = Mpi::World();
+  VecType x(size);
+  std::vector<VecType> y(n);
+  x.UseDevice(true);
+  linalg::SetRandom(comm, x, 1);
+  for (int j = 0; j < n; j++)
+  {
+    y[j].SetSize(size);
+    y[j].UseDevice(true);
+    linalg::SetRandom(comm, y[j], 2 + j);
+  }
+
+  // Inner products dot[j] = y[j]ᴴ x.
+  std::vector<ScalarType> dot(n), dot_ref(n);
+  linalg::LocalMDot(x, y.data(), n, dot.data());
+  for (int j = 0; j < n; j++)
+  {
+    dot_ref[j] = linalg::LocalDot(x, y[j]);
+    REQUIRE(std::abs(dot[j] - dot_ref[j]) <= 1.0e-12 * std::max(std::abs(dot_ref[j]), 1.0));
+  }
+
+  // Update x += s * (alpha[0] * y[0] + ... + alpha[n - 1] * y[n - 1]).
+  constexpr double s = -0.5;
+  std::vector<ScalarType> alpha(n);
+  for (int j = 0; j < n; j++)
+  {
+    alpha[j] = dot_ref[j] / static_cast<double>(size);
+  }
+  VecType x_ref(x);
+  x_ref.UseDevice(true);
+  for (int j = 0; j < n; j++)
+  {
+    linalg::AXPY(s * alpha[j], y[j], x_ref);
+  }
+  linalg::MAXPY(n, alpha.data(), y.data(), x, s);
+  linalg::AXPY(-1.0, x_ref, x);
+  REQUIRE(MaxNorm(x) <= 1.0e-12 * std::max(MaxNorm(x_ref), 1.0));
+}
+
+}  // namespace
+
+TEST_CASE("Multi-Vector Kernels", "[Vector]")
+{
+  auto size = GENERATE(1, 17, 1023, 1025, 3 * 1024 + 17);
+  auto n = GENERATE(1, 2, 5, 9);
+  SECTION("Real")
+  {
+    TestMultiVectorKernels<Vector, double>(size, n);
+  }
+  SECTION("Complex")
+  {
+    TestMultiVectorKernels<ComplexVector, std::complex<double>>(size, n);
+  }
+}
+
+}  // namespace palace